@@ -0,0 +1,139 @@
+#include "incrementalListProblems.hpp"
+
+#include <algorithm>
+
+using namespace Day01;
+
+IncrementalListProblems::IncrementalListProblems(ListElement maxElementValue)
+	: maxElementValue(std::max<ListElement>(0, maxElementValue)), numElementsInListOne(0), numElementsInListTwo(0), similarityScore(0)
+{
+	numOccurrencesInListOne.resize(static_cast<std::size_t>(this->maxElementValue) + 1, 0);
+	numOccurrencesInListTwo.resize(static_cast<std::size_t>(this->maxElementValue) + 1, 0);
+	differenceOfCountsTree.resize(4 * std::max<std::size_t>(1, static_cast<std::size_t>(this->maxElementValue)), DifferenceOfCountsNode{ 0, 0, 0, 0, 0 });
+}
+
+bool IncrementalListProblems::insertElement(ListIdentifier list, ListElement element)
+{
+	if (!isElementWithinValueDomain(element))
+		return false;
+
+	updateElementCount(list, element, 1);
+	return true;
+}
+
+bool IncrementalListProblems::removeElement(ListIdentifier list, ListElement element)
+{
+	if (!isElementWithinValueDomain(element))
+		return false;
+
+	const std::vector<std::size_t>& numOccurrencesInList = list == ListIdentifier::ListOne ? numOccurrencesInListOne : numOccurrencesInListTwo;
+	if (!numOccurrencesInList[static_cast<std::size_t>(element)])
+		return false;
+
+	updateElementCount(list, element, -1);
+	return true;
+}
+
+std::optional<long> IncrementalListProblems::getSumOfPairwiseDistances() const noexcept
+{
+	if (numElementsInListOne != numElementsInListTwo)
+		return std::nullopt;
+	return maxElementValue ? differenceOfCountsTree.front().sumOfAbsoluteDifferences : 0;
+}
+
+long IncrementalListProblems::getSimilarityScore() const noexcept
+{
+	return similarityScore;
+}
+
+std::size_t IncrementalListProblems::getNumElements(ListIdentifier list) const noexcept
+{
+	return list == ListIdentifier::ListOne ? numElementsInListOne : numElementsInListTwo;
+}
+
+inline bool IncrementalListProblems::isElementWithinValueDomain(ListElement element) const noexcept
+{
+	return element >= 0 && element <= maxElementValue;
+}
+
+void IncrementalListProblems::updateElementCount(ListIdentifier list, ListElement element, long countDelta)
+{
+	const auto valueIndex = static_cast<std::size_t>(element);
+	const bool isListOneUpdated = list == ListIdentifier::ListOne;
+	const std::size_t numOccurrencesInOtherList = isListOneUpdated ? numOccurrencesInListTwo[valueIndex] : numOccurrencesInListOne[valueIndex];
+	similarityScore += countDelta * element * static_cast<long>(numOccurrencesInOtherList);
+
+	if (isListOneUpdated)
+	{
+		numOccurrencesInListOne[valueIndex] += countDelta;
+		numElementsInListOne += countDelta;
+	}
+	else
+	{
+		numOccurrencesInListTwo[valueIndex] += countDelta;
+		numElementsInListTwo += countDelta;
+	}
+
+	if (element < maxElementValue)
+		addToDifferenceOfCounts(0, 0, static_cast<std::size_t>(maxElementValue) - 1, valueIndex, isListOneUpdated ? countDelta : -countDelta);
+}
+
+void IncrementalListProblems::addToDifferenceOfCounts(std::size_t nodeIndex, std::size_t nodeFirstValue, std::size_t nodeLastValue, std::size_t firstUpdatedValue, long differenceDelta)
+{
+	if (nodeLastValue < firstUpdatedValue)
+		return;
+
+	// Nodes in which the update does not change the sign of any difference can be updated without visiting their children, this includes all leaf nodes.
+	if (nodeFirstValue >= firstUpdatedValue && doesDifferenceUpdateKeepSignsOfNode(differenceOfCountsTree[nodeIndex], differenceDelta))
+	{
+		applyDifferenceUpdateToNode(nodeIndex, nodeLastValue - nodeFirstValue + 1, differenceDelta);
+		return;
+	}
+
+	propagatePendingDifferenceUpdate(nodeIndex, nodeFirstValue, nodeLastValue);
+	const std::size_t nodeMiddleValue = nodeFirstValue + (nodeLastValue - nodeFirstValue) / 2;
+	addToDifferenceOfCounts(2 * nodeIndex + 1, nodeFirstValue, nodeMiddleValue, firstUpdatedValue, differenceDelta);
+	addToDifferenceOfCounts(2 * nodeIndex + 2, nodeMiddleValue + 1, nodeLastValue, firstUpdatedValue, differenceDelta);
+	updateNodeFromChildren(nodeIndex);
+}
+
+void IncrementalListProblems::applyDifferenceUpdateToNode(std::size_t nodeIndex, std::size_t numValuesOfNode, long differenceDelta) noexcept
+{
+	// All differences of a node are either non-negative or non-positive after an update that kept their signs.
+	DifferenceOfCountsNode& node = differenceOfCountsTree[nodeIndex];
+	node.minDifference += differenceDelta;
+	node.maxDifference += differenceDelta;
+	node.sumOfDifferences += differenceDelta * static_cast<long>(numValuesOfNode);
+	node.sumOfAbsoluteDifferences = node.minDifference >= 0 ? node.sumOfDifferences : -node.sumOfDifferences;
+	node.pendingDifferenceUpdate += differenceDelta;
+}
+
+void IncrementalListProblems::propagatePendingDifferenceUpdate(std::size_t nodeIndex, std::size_t nodeFirstValue, std::size_t nodeLastValue) noexcept
+{
+	DifferenceOfCountsNode& node = differenceOfCountsTree[nodeIndex];
+	if (!node.pendingDifferenceUpdate)
+		return;
+
+	const std::size_t nodeMiddleValue = nodeFirstValue + (nodeLastValue - nodeFirstValue) / 2;
+	applyDifferenceUpdateToNode(2 * nodeIndex + 1, nodeMiddleValue - nodeFirstValue + 1, node.pendingDifferenceUpdate);
+	applyDifferenceUpdateToNode(2 * nodeIndex + 2, nodeLastValue - nodeMiddleValue, node.pendingDifferenceUpdate);
+	node.pendingDifferenceUpdate = 0;
+}
+
+void IncrementalListProblems::updateNodeFromChildren(std::size_t nodeIndex) noexcept
+{
+	DifferenceOfCountsNode& node = differenceOfCountsTree[nodeIndex];
+	const DifferenceOfCountsNode& leftChild = differenceOfCountsTree[2 * nodeIndex + 1];
+	const DifferenceOfCountsNode& rightChild = differenceOfCountsTree[2 * nodeIndex + 2];
+	node.minDifference = std::min(leftChild.minDifference, rightChild.minDifference);
+	node.maxDifference = std::max(leftChild.maxDifference, rightChild.maxDifference);
+	node.sumOfDifferences = leftChild.sumOfDifferences + rightChild.sumOfDifferences;
+	node.sumOfAbsoluteDifferences = leftChild.sumOfAbsoluteDifferences + rightChild.sumOfAbsoluteDifferences;
+}
+
+inline bool IncrementalListProblems::doesDifferenceUpdateKeepSignsOfNode(const DifferenceOfCountsNode& node, long differenceDelta) noexcept
+{
+	return differenceDelta > 0
+		? node.minDifference >= 0 || node.maxDifference <= -1
+		: node.minDifference >= 1 || node.maxDifference <= 0;
+}
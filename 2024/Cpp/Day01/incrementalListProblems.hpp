@@ -0,0 +1,66 @@
+#ifndef DAY01_INCREMENTAL_LIST_PROBLEMS_HPP
+#define DAY01_INCREMENTAL_LIST_PROBLEMS_HPP
+
+#include "listProblems.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace Day01 {
+	/// Maintains the sum of pairwise distances and the similarity score of two lists with elements in the range [0, maxElementValue] while elements are inserted into or removed from the lists.
+	/// The similarity score is updated in constant time. The sum of pairwise distances is determined as the sum of |CA(x) - CB(x)| over all values x with CA(x) and CB(x) being the number of elements of
+	/// the first and second list that are smaller than or equal to x, which is stored in a segment tree. An update of the lists adds +/-1 to a suffix of the value domain and requires O(log m) steps
+	/// for every range of values in which the difference changes its sign (with m being the size of the value domain).
+	class IncrementalListProblems {
+	public:
+		using ListElement = ListProblems::ListElement;
+
+		enum class ListIdentifier : char
+		{
+			ListOne,
+			ListTwo
+		};
+
+		explicit IncrementalListProblems(ListElement maxElementValue);
+
+		/// @return Whether the element was inserted, elements outside of the value domain are rejected
+		[[nodiscard]] bool insertElement(ListIdentifier list, ListElement element);
+		/// @return Whether the element was removed, elements not contained in the list are rejected
+		[[nodiscard]] bool removeElement(ListIdentifier list, ListElement element);
+
+		/// @return The sum of pairwise distances of both sorted lists, which is only defined if both lists contain the same number of elements
+		[[nodiscard]] std::optional<long> getSumOfPairwiseDistances() const noexcept;
+		[[nodiscard]] long getSimilarityScore() const noexcept;
+		[[nodiscard]] std::size_t getNumElements(ListIdentifier list) const noexcept;
+
+	protected:
+		struct DifferenceOfCountsNode
+		{
+			long minDifference;
+			long maxDifference;
+			long sumOfDifferences;
+			long sumOfAbsoluteDifferences;
+			long pendingDifferenceUpdate;
+		};
+
+		ListElement maxElementValue;
+		std::vector<std::size_t> numOccurrencesInListOne;
+		std::vector<std::size_t> numOccurrencesInListTwo;
+		std::size_t numElementsInListOne;
+		std::size_t numElementsInListTwo;
+		long similarityScore;
+		// Covers the values [0, maxElementValue) since the difference of the counts at the maximum value is equal to the difference of the list sizes.
+		std::vector<DifferenceOfCountsNode> differenceOfCountsTree;
+
+		[[nodiscard]] bool isElementWithinValueDomain(ListElement element) const noexcept;
+		void updateElementCount(ListIdentifier list, ListElement element, long countDelta);
+		void addToDifferenceOfCounts(std::size_t nodeIndex, std::size_t nodeFirstValue, std::size_t nodeLastValue, std::size_t firstUpdatedValue, long differenceDelta);
+		void applyDifferenceUpdateToNode(std::size_t nodeIndex, std::size_t numValuesOfNode, long differenceDelta) noexcept;
+		void propagatePendingDifferenceUpdate(std::size_t nodeIndex, std::size_t nodeFirstValue, std::size_t nodeLastValue) noexcept;
+		void updateNodeFromChildren(std::size_t nodeIndex) noexcept;
+		[[nodiscard]] static bool doesDifferenceUpdateKeepSignsOfNode(const DifferenceOfCountsNode& node, long differenceDelta) noexcept;
+	};
+}
+
+#endif
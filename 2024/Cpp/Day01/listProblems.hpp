@@ -1,14 +1,78 @@
 #ifndef DAY01_LIST_PROBLEMS_HPP
 #define DAY01_LIST_PROBLEMS_HPP
 
+#include "../utils/bulkNumberParser.hpp"
+#include "../utils/radixSort.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
 #include <numeric>
 #include <optional>
 #include <queue>
-#include <unordered_map>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace Day01 {
 	class ListProblems {
 	public:
+		using ListElement = long;
+
+		struct ListColumns
+		{
+			std::vector<ListElement> listOne;
+			std::vector<ListElement> listTwo;
+		};
+
+		[[nodiscard]] static std::optional<long> calculateSumOfPairwiseDistances(const std::string& inputFileNamePath);
+		[[nodiscard]] static std::optional<long> calculateSimilarityScore(const std::string& inputFileNamePath);
+
+		/// Reads the two whitespace separated columns of the given file (one pair of numbers per row) into two lists, the parsing is distributed over the given number of threads (zero will use the number of hardware threads).
+		[[nodiscard]] static std::optional<ListColumns> parseListsFromFile(const std::string& inputFileNamePath, std::size_t numThreads = 0);
+		[[nodiscard]] static std::optional<ListColumns> parseListsFromBuffer(std::string_view inputBuffer, std::size_t numThreads = 0);
+
+		struct SumOfPairwiseDistancesAndSimilarityScore
+		{
+			std::optional<long> sumOfPairwiseDistances;
+			long similarityScore;
+		};
+
+		[[nodiscard]] static std::optional<SumOfPairwiseDistancesAndSimilarityScore> calculateSumOfPairwiseDistancesAndSimilarityScore(const std::string& inputFileNamePath);
+
+		/// Processes lists that do not fit into memory by writing sorted runs of both lists to temporary files which are afterwards merged in ascending order of their values.
+		/// If the buffers of all runs do not fit into the budget at once, groups of runs are merged into longer runs in additional passes until they do.
+		/// The memory used by the calculation is approximately bounded by the given budget (with a lower limit of MIN_EXTERNAL_MEMORY_BUDGET_IN_BYTES).
+		[[nodiscard]] static std::optional<SumOfPairwiseDistancesAndSimilarityScore> calculateSumOfPairwiseDistancesAndSimilarityScoreOutOfCore(const std::string& inputFileNamePath, std::size_t memoryBudgetInBytes);
+
+		/// Sorts both lists in place instead of operating on a sorted copy of the lists, lists of integral elements are radix sorted using the given number of threads (zero will use the number of hardware threads).
+		/// The distances are only accumulated by more than one thread if every thread is assigned at least the given number of elements.
+		template <typename T>
+		[[nodiscard]] static std::optional<long> calculateSumOfPairwiseDistancesOfSortableLists(std::vector<T>& listOne, std::vector<T>& listTwo, std::size_t numThreads = 1, std::size_t minNumElementsPerThread = MIN_NUM_ELEMENTS_PER_DISTANCE_REDUCTION_THREAD)
+		{
+			if (listOne.size() != listTwo.size())
+				return std::nullopt;
+
+			sortListsInPlace(listOne, listTwo, numThreads);
+			return calculateSumOfPairwiseDistancesOfSortedLists(listOne, listTwo, numThreads, minNumElementsPerThread);
+		}
+
+		/// Both metrics are calculated from the same sorted lists, the similarity score is determined by merging the runs of equal elements in both lists.
+		template <typename T>
+		[[nodiscard]] static SumOfPairwiseDistancesAndSimilarityScore calculateSumOfPairwiseDistancesAndSimilarityScoreOfSortableLists(std::vector<T>& listOne, std::vector<T>& listTwo, std::size_t numThreads = 1)
+		{
+			sortListsInPlace(listOne, listTwo, numThreads);
+			return SumOfPairwiseDistancesAndSimilarityScore{
+				listOne.size() == listTwo.size() ? calculateSumOfPairwiseDistancesOfSortedLists(listOne, listTwo, numThreads, MIN_NUM_ELEMENTS_PER_DISTANCE_REDUCTION_THREAD) : std::nullopt,
+				calculateSimilarityScoreOfSortedLists(listOne, listTwo)
+			};
+		}
+
 		// TODO: Check whether - operator for type T is defined
 		// TODO: Overflow handling
 		// TODO: Define whether we expect that all elements of the list are only positive integer
@@ -22,21 +86,16 @@ namespace Day01 {
 			if (!numListElements)
 				return 0;
 
-			std::vector<T> minPriorityContainerOfListOne(listOneStartIter, listOneEndIter);
-			std::vector<T> minPriorityContainerOfListTwo(listTwoStartIter, listTwoEndIter);
-			std::sort(minPriorityContainerOfListOne.begin(), minPriorityContainerOfListOne.end(), std::less());
-			std::sort(minPriorityContainerOfListTwo.begin(), minPriorityContainerOfListTwo.end(), std::less());
-
-			long sumOfPairwiseDistances = 0;
-			bool continueCalculation = true;
-			for (std::size_t i = 0; i < numListElements && continueCalculation; ++i)
+			// Lists that are already sorted do not need to be copied
+			if constexpr (std::is_integral_v<T>)
 			{
-				const T minElemOfFirstList = minPriorityContainerOfListOne[i];
-				const T minElemOfSecondList = minPriorityContainerOfListTwo[i];
-				continueCalculation = minElemOfFirstList >= 0 && minElemOfSecondList >= 0;
-				sumOfPairwiseDistances += std::abs(minElemOfFirstList - minElemOfSecondList);
+				if (std::is_sorted(listOneStartIter, listOneEndIter) && std::is_sorted(listTwoStartIter, listTwoEndIter))
+					return validateSignsOfPartialSumOfPairwiseDistances(accumulatePairwiseDistances(listOneStartIter, listTwoStartIter, numListElements));
 			}
-			return  continueCalculation ? std::make_optional(sumOfPairwiseDistances) : std::nullopt;
+
+			std::vector<T> minPriorityContainerOfListOne(listOneStartIter, listOneEndIter);
+			std::vector<T> minPriorityContainerOfListTwo(listTwoStartIter, listTwoEndIter);
+			return calculateSumOfPairwiseDistancesOfSortableLists(minPriorityContainerOfListOne, minPriorityContainerOfListTwo);
 		}
 
 		template<typename Iterator, typename T = typename std::iterator_traits<Iterator>::value_type>
@@ -45,21 +104,335 @@ namespace Day01 {
 			if (listOneStartIter == listOneEndIter || listTwoStartIter == listTwoEndIter)
 				return 0;
 
+			// The occurrences of the elements of the second list are counted in a flat array if the value range of the second list is small enough, otherwise the score is determined from sorted copies of both lists.
+			if constexpr (std::is_integral_v<T>)
+			{
+				const auto [minElemOfListTwo, maxElemOfListTwo] = std::minmax_element(listTwoStartIter, listTwoEndIter);
+				const std::size_t numElements = static_cast<std::size_t>(std::distance(listOneStartIter, listOneEndIter) + std::distance(listTwoStartIter, listTwoEndIter));
+				if (const std::optional<std::size_t> numCountingBuckets = determineNumberOfCountingBuckets(*minElemOfListTwo, *maxElemOfListTwo, numElements); numCountingBuckets.has_value())
+					return calculateSimilarityScoreUsingCountingArray(listOneStartIter, listOneEndIter, listTwoStartIter, listTwoEndIter, *minElemOfListTwo, *numCountingBuckets);
+			}
+
+			std::vector<T> sortedListOne(listOneStartIter, listOneEndIter);
+			std::vector<T> sortedListTwo(listTwoStartIter, listTwoEndIter);
+			sortListsInPlace(sortedListOne, sortedListTwo, 1);
+			return calculateSimilarityScoreOfSortedLists(sortedListOne, sortedListTwo);
+		}
+		static constexpr std::size_t MIN_EXTERNAL_MEMORY_BUDGET_IN_BYTES = 1 << 16;
+	protected:
+		/// Temporary file that is removed when the owning instance is destroyed.
+		class TemporaryRunFile
+		{
+		public:
+			explicit TemporaryRunFile(std::filesystem::path filePath)
+				: filePath(std::move(filePath)) {}
+			~TemporaryRunFile();
+
+			TemporaryRunFile(const TemporaryRunFile&) = delete;
+			TemporaryRunFile& operator=(const TemporaryRunFile&) = delete;
+			TemporaryRunFile(TemporaryRunFile&& other) noexcept
+				: filePath(std::move(other.filePath))
+			{
+				other.filePath.clear();
+			}
+			TemporaryRunFile& operator=(TemporaryRunFile&&) = delete;
+
+			[[nodiscard]] const std::filesystem::path& getFilePath() const noexcept
+			{
+				return filePath;
+			}
+
+		protected:
+			std::filesystem::path filePath;
+		};
+
+		/// Merges the sorted runs stored in the given files into a single ascending sequence of elements while only buffering a fixed number of elements per run.
+		class SortedRunsMerger
+		{
+		public:
+			SortedRunsMerger(const std::vector<TemporaryRunFile>& runFiles, std::size_t numBufferedElementsPerRun);
+
+			[[nodiscard]] bool hasFailed() const noexcept
+			{
+				return failed;
+			}
+
+			[[nodiscard]] std::optional<ListElement> peekNextElement() const noexcept
+			{
+				return nextElementPerRunOrderedByValue.empty() ? std::nullopt : std::make_optional(nextElementPerRunOrderedByValue.top().first);
+			}
+
+			/// @return The number of removed elements that were equal to the given value
+			std::size_t removeAllOccurrencesOfElement(ListElement element);
+
+		protected:
+			struct RunReader
+			{
+				std::ifstream inputStream;
+				std::vector<ListElement> bufferedElements;
+				std::size_t numBufferedElements;
+				std::size_t nextBufferedElementIndex;
+			};
+			using RunHead = std::pair<ListElement, std::size_t>;
+
+			std::vector<RunReader> runReaders;
+			std::priority_queue<RunHead, std::vector<RunHead>, std::greater<RunHead>> nextElementPerRunOrderedByValue;
+			bool failed;
+
+			void fetchNextElementOfRun(std::size_t runIndex);
+		};
+
+		[[nodiscard]] static std::optional<std::filesystem::path> generateTemporaryRunFilePath();
+		[[nodiscard]] static bool writeSortedRunToTemporaryFile(std::vector<ListElement>& runElements, utils::RadixSorter<ListElement>& radixSorter, std::vector<TemporaryRunFile>& runFiles);
+		/// Replaces groups of the given runs by their merged run until at most the given number of runs remains, at most maxNumSimultaneouslyMergedRuns - 1 runs are merged at once since the merged run requires a buffer too.
+		[[nodiscard]] static bool mergeRunsUntilNumberOfRunsIsAtMost(std::vector<TemporaryRunFile>& runFiles, std::size_t maxNumRuns, std::size_t maxNumSimultaneouslyMergedRuns, std::size_t numBufferedElementsPerRun);
+		[[nodiscard]] static bool mergeRunsIntoTemporaryFile(const std::vector<TemporaryRunFile>& runFiles, std::size_t numBufferedElementsPerRun, std::vector<TemporaryRunFile>& mergedRunFiles);
+
+		static constexpr std::size_t MIN_NUM_COUNTING_BUCKETS_ALLOCATED_REGARDLESS_OF_NUM_ELEMENTS = 1 << 17;
+		static constexpr std::size_t MAX_NUM_COUNTING_BUCKETS = 1 << 24;
+		static constexpr std::size_t MIN_NUM_ELEMENTS_PER_DISTANCE_REDUCTION_THREAD = 1 << 18;
+		static constexpr std::size_t MAX_NUM_ASCENDING_RUNS_FOR_RUN_MERGE = 16;
+		static constexpr std::size_t MIN_NUM_BUFFERED_ELEMENTS_PER_MERGED_RUN = 512;
+
+		/// Both lists share one radix sorter whose scratch buffer is released on return, the buffer is not kept between calls.
+		template <typename T>
+		static void sortListsInPlace(std::vector<T>& listOne, std::vector<T>& listTwo, std::size_t numThreads)
+		{
+			if constexpr (std::is_integral_v<T>)
+			{
+				utils::RadixSorter<T> radixSorter;
+				auto radixSortList = [&radixSorter, numThreads](std::vector<T>& list) { radixSorter.sortInParallel(list, numThreads); };
+				sortListAdaptively(listOne, radixSortList);
+				sortListAdaptively(listTwo, radixSortList);
+			}
+			else
+			{
+				auto sortList = [](std::vector<T>& list) { std::sort(list.begin(), list.end(), std::less()); };
+				sortListAdaptively(listOne, sortList);
+				sortListAdaptively(listTwo, sortList);
+			}
+		}
+
+		/// Lists consisting of few ascending runs (i.e. lists that were appended to in order) are sorted by merging the runs while sorted or descendingly sorted lists do not require merging at all.
+		/// Only lists with more runs are sorted using the given sort function.
+		template <typename T, typename FullSort>
+		static void sortListAdaptively(std::vector<T>& list, FullSort&& fullSort)
+		{
+			if (std::optional<std::vector<std::size_t>> startIndicesOfAscendingRuns = determineStartIndicesOfAscendingRuns(list, MAX_NUM_ASCENDING_RUNS_FOR_RUN_MERGE); startIndicesOfAscendingRuns.has_value())
+			{
+				mergeAscendingRuns(list, *startIndicesOfAscendingRuns);
+				return;
+			}
+
+			if (std::is_sorted(list.cbegin(), list.cend(), std::greater()))
+			{
+				std::reverse(list.begin(), list.end());
+				return;
+			}
+			fullSort(list);
+		}
+
+		/// @return The start indices of the ascending runs of the list followed by the size of the list, the search is aborted once the list consists of more than the given number of runs
+		template <typename T>
+		[[nodiscard]] static std::optional<std::vector<std::size_t>> determineStartIndicesOfAscendingRuns(const std::vector<T>& list, std::size_t maxNumRuns)
+		{
+			std::vector<std::size_t> startIndicesOfAscendingRuns{ 0 };
+			for (std::size_t i = 1; i < list.size(); ++i)
+			{
+				if (!(list[i] < list[i - 1]))
+					continue;
+
+				if (startIndicesOfAscendingRuns.size() == maxNumRuns)
+					return std::nullopt;
+				startIndicesOfAscendingRuns.emplace_back(i);
+			}
+			startIndicesOfAscendingRuns.emplace_back(list.size());
+			return startIndicesOfAscendingRuns;
+		}
+
+		template <typename T>
+		static void mergeAscendingRuns(std::vector<T>& list, std::vector<std::size_t>& startIndicesOfAscendingRuns)
+		{
+			// Neighbouring runs are merged pairwise until only one run remains (the last entry marks the end of the list)
+			while (startIndicesOfAscendingRuns.size() > 2)
+			{
+				std::size_t numMergedRuns = 0;
+				for (std::size_t i = 0; i + 1 < startIndicesOfAscendingRuns.size(); i += 2)
+				{
+					if (i + 2 < startIndicesOfAscendingRuns.size())
+						std::inplace_merge(list.begin() + startIndicesOfAscendingRuns[i], list.begin() + startIndicesOfAscendingRuns[i + 1], list.begin() + startIndicesOfAscendingRuns[i + 2]);
+					startIndicesOfAscendingRuns[numMergedRuns++] = startIndicesOfAscendingRuns[i];
+				}
+				startIndicesOfAscendingRuns[numMergedRuns++] = startIndicesOfAscendingRuns.back();
+				startIndicesOfAscendingRuns.resize(numMergedRuns);
+			}
+		}
+
+		template <typename T>
+		struct alignas(64) PartialSumOfPairwiseDistances
+		{
+			long sumOfPairwiseDistances;
+			T combinedBitsOfElements;
+		};
+
+		/// The distances of lists of integral elements are accumulated in chunks of at least the given number of elements processed by separate threads (zero will use the number of hardware threads).
+		template <typename T>
+		[[nodiscard]] static std::optional<long> calculateSumOfPairwiseDistancesOfSortedLists(const std::vector<T>& listOne, const std::vector<T>& listTwo, std::size_t numThreads, std::size_t minNumElementsPerThread)
+		{
+			if constexpr (!std::is_integral_v<T>)
+			{
+				long sumOfPairwiseDistances = 0;
+				bool continueCalculation = true;
+				for (std::size_t i = 0; i < listOne.size() && continueCalculation; ++i)
+				{
+					const T minElemOfFirstList = listOne[i];
+					const T minElemOfSecondList = listTwo[i];
+					continueCalculation = minElemOfFirstList >= 0 && minElemOfSecondList >= 0;
+					sumOfPairwiseDistances += std::abs(minElemOfFirstList - minElemOfSecondList);
+				}
+				return  continueCalculation ? std::make_optional(sumOfPairwiseDistances) : std::nullopt;
+			}
+			else
+			{
+				if (!numThreads)
+					numThreads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+				numThreads = std::max<std::size_t>(1, std::min(numThreads, listOne.size() / std::max<std::size_t>(1, minNumElementsPerThread)));
+
+				std::vector<PartialSumOfPairwiseDistances<T>> partialSumsOfPairwiseDistances(numThreads);
+				const std::size_t numElementsPerThread = listOne.size() / numThreads;
+				auto accumulateChunk = [&](std::size_t threadIndex)
+				{
+					const std::size_t firstElementIndex = threadIndex * numElementsPerThread;
+					const std::size_t lastElementIndex = threadIndex + 1 == numThreads ? listOne.size() : firstElementIndex + numElementsPerThread;
+					partialSumsOfPairwiseDistances[threadIndex] = accumulatePairwiseDistances(listOne.data() + firstElementIndex, listTwo.data() + firstElementIndex, lastElementIndex - firstElementIndex);
+				};
+
+				std::vector<std::thread> workerThreads;
+				workerThreads.reserve(numThreads - 1);
+				for (std::size_t threadIndex = 1; threadIndex < numThreads; ++threadIndex)
+					workerThreads.emplace_back(accumulateChunk, threadIndex);
+
+				accumulateChunk(0);
+				for (std::thread& workerThread : workerThreads)
+					workerThread.join();
+
+				long sumOfPairwiseDistances = 0;
+				T combinedBitsOfElements = 0;
+				for (const PartialSumOfPairwiseDistances<T>& partialSumOfPairwiseDistances : partialSumsOfPairwiseDistances)
+				{
+					sumOfPairwiseDistances += partialSumOfPairwiseDistances.sumOfPairwiseDistances;
+					combinedBitsOfElements |= partialSumOfPairwiseDistances.combinedBitsOfElements;
+				}
+
+				return validateSignsOfPartialSumOfPairwiseDistances(PartialSumOfPairwiseDistances<T>{ sumOfPairwiseDistances, combinedBitsOfElements });
+			}
+		}
+
+		template <typename T>
+		[[nodiscard]] static std::optional<long> validateSignsOfPartialSumOfPairwiseDistances(const PartialSumOfPairwiseDistances<T>& partialSumOfPairwiseDistances) noexcept
+		{
+			// The sign bit of the combination of all elements is only set if at least one element was negative
+			if constexpr (std::is_signed_v<T>)
+			{
+				if (partialSumOfPairwiseDistances.combinedBitsOfElements < 0)
+					return std::nullopt;
+			}
+			return partialSumOfPairwiseDistances.sumOfPairwiseDistances;
+		}
+
+		/// Scalar, branch free accumulation of the absolute differences which also combines the bits of all elements to validate the signs of the elements after the loop.
+		/// There is no explicit SIMD kernel, the loop is only vectorized by the compiler for targets offering 64-bit vector comparisons (e.g. AVX2).
+		template <typename Iterator, typename T = typename std::iterator_traits<Iterator>::value_type>
+		[[nodiscard]] static PartialSumOfPairwiseDistances<T> accumulatePairwiseDistances(Iterator listOneElements, Iterator listTwoElements, std::size_t numElements) noexcept
+		{
+			long sumOfPairwiseDistances = 0;
+			T combinedBitsOfElements = 0;
+			for (std::size_t i = 0; i < numElements; ++i, ++listOneElements, ++listTwoElements)
+			{
+				const T elemOfFirstList = *listOneElements;
+				const T elemOfSecondList = *listTwoElements;
+				combinedBitsOfElements |= elemOfFirstList | elemOfSecondList;
+				sumOfPairwiseDistances += static_cast<long>(elemOfFirstList > elemOfSecondList ? elemOfFirstList - elemOfSecondList : elemOfSecondList - elemOfFirstList);
+			}
+			return PartialSumOfPairwiseDistances<T>{ sumOfPairwiseDistances, combinedBitsOfElements };
+		}
+
+		template <typename T>
+		[[nodiscard]] static long calculateSimilarityScoreOfSortedLists(const std::vector<T>& sortedListOne, const std::vector<T>& sortedListTwo)
+		{
 			long similarityScore = 0;
-			std::unordered_map<T, long> occurrenceCountOfElementsInListTwo;
+			std::size_t listOneIndex = 0;
+			std::size_t listTwoIndex = 0;
+			while (listOneIndex < sortedListOne.size() && listTwoIndex < sortedListTwo.size())
+			{
+				const T currElemInListOne = sortedListOne[listOneIndex];
+				const T currElemInListTwo = sortedListTwo[listTwoIndex];
+				if (currElemInListOne < currElemInListTwo)
+				{
+					++listOneIndex;
+					continue;
+				}
+				if (currElemInListTwo < currElemInListOne)
+				{
+					++listTwoIndex;
+					continue;
+				}
+
+				long numOccurrencesInListOne = 0;
+				for (; listOneIndex < sortedListOne.size() && !(currElemInListOne < sortedListOne[listOneIndex]); ++listOneIndex)
+					++numOccurrencesInListOne;
+
+				long numOccurrencesInListTwo = 0;
+				for (; listTwoIndex < sortedListTwo.size() && !(currElemInListTwo < sortedListTwo[listTwoIndex]); ++listTwoIndex)
+					++numOccurrencesInListTwo;
+
+				similarityScore += currElemInListOne * numOccurrencesInListOne * numOccurrencesInListTwo;
+			}
+			return similarityScore;
+		}
+
+		/// The counting array is only used if it spans at most twice as many buckets as there are elements in both lists (or a fixed minimum) to keep its initialization cost proportional to the input.
+		template <typename T>
+		[[nodiscard]] static std::optional<std::size_t> determineNumberOfCountingBuckets(T minElement, T maxElement, std::size_t numElements)
+		{
+			const auto valueRange = static_cast<std::make_unsigned_t<T>>(static_cast<std::make_unsigned_t<T>>(maxElement) - static_cast<std::make_unsigned_t<T>>(minElement));
+			const std::size_t maxNumCountingBuckets = std::min(MAX_NUM_COUNTING_BUCKETS, std::max(MIN_NUM_COUNTING_BUCKETS_ALLOCATED_REGARDLESS_OF_NUM_ELEMENTS, 2 * numElements));
+			if (valueRange >= maxNumCountingBuckets)
+				return std::nullopt;
+			return static_cast<std::size_t>(valueRange) + 1;
+		}
+
+		template <typename Iterator, typename T = typename std::iterator_traits<Iterator>::value_type>
+		[[nodiscard]] static long calculateSimilarityScoreUsingCountingArray(const Iterator listOneStartIter, const Iterator listOneEndIter, const Iterator listTwoStartIter, const Iterator listTwoEndIter, T minElemOfListTwo, std::size_t numCountingBuckets)
+		{
+			using UnsignedT = std::make_unsigned_t<T>;
+			std::vector<long> occurrenceCountOfElementsInListTwo(numCountingBuckets, 0);
 			for (auto curr = listTwoStartIter, end = listTwoEndIter; curr != end; ++curr)
-				++occurrenceCountOfElementsInListTwo[*curr];
+				++occurrenceCountOfElementsInListTwo[static_cast<UnsignedT>(static_cast<UnsignedT>(*curr) - static_cast<UnsignedT>(minElemOfListTwo))];
 
-			const auto notFoundEntryInListTwo = occurrenceCountOfElementsInListTwo.end();
+			long similarityScore = 0;
 			for (auto curr = listOneStartIter, end = listOneEndIter; curr != end; ++curr)
 			{
 				const T currElemInListOne = *curr;
-				const auto& matchingEntryInLookupForSecondListLiteralOccurrences = occurrenceCountOfElementsInListTwo.find(currElemInListOne);
-				const long literalOccurrenceFrequency = matchingEntryInLookupForSecondListLiteralOccurrences != notFoundEntryInListTwo;
-				similarityScore += currElemInListOne * literalOccurrenceFrequency;
+				// Elements smaller than the minimum of the second list wrap around to a bucket index outside of the counting array
+				const auto bucketIndex = static_cast<UnsignedT>(static_cast<UnsignedT>(currElemInListOne) - static_cast<UnsignedT>(minElemOfListTwo));
+				if (bucketIndex < numCountingBuckets)
+					similarityScore += currElemInListOne * occurrenceCountOfElementsInListTwo[bucketIndex];
 			}
 			return similarityScore;
 		}
+
+		struct ListColumnsChunk
+		{
+			std::size_t firstByteOffset;
+			std::size_t lastByteOffset;
+			std::size_t firstRowIndex;
+		};
+
+		[[nodiscard]] static std::vector<ListColumnsChunk> splitBufferIntoChunksAtRowBoundaries(std::string_view inputBuffer, std::size_t numChunks);
+		[[nodiscard]] static std::size_t determineNumberOfRowsInChunk(std::string_view chunk) noexcept;
+		[[nodiscard]] static bool parseRowsOfChunk(std::string_view chunk, ListElement* listOneElements, ListElement* listTwoElements) noexcept;
+		[[nodiscard]] static bool isColumnSeparator(char character) noexcept;
 	};
 }
 
@@ -1,192 +1,548 @@
 #include "levelAnalysis.hpp"
+#include "../utils/bulkNumberParser.hpp"
 
 #include <algorithm>
-#include <cctype>
+#include <bitset>
 #include <fstream>
 #include <iostream>
 #include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define DAY02_SSE2_BATCH_KERNEL_AVAILABLE
+#include <emmintrin.h>
+#endif
 
 using namespace Day02;
 
+std::optional<LevelAnalysis::NumbersOfValidReports> LevelAnalysis::determineNumbersOfValidReports(const std::string& inputFileNamePath)
+{
+	std::ifstream inputStream(inputFileNamePath, std::ios::binary);
+	if (!inputStream.is_open())
+		return std::nullopt;
+	return determineNumbersOfValidReports(inputStream);
+}
+
+std::optional<LevelAnalysis::NumbersOfValidReports> LevelAnalysis::determineNumbersOfValidReports(std::istream& inputStream)
+{
+	NumbersOfValidReports numbersOfValidReports{ 0, 0 };
+	StreamingLevelReportValidator levelReportValidator;
+	auto processLevel = [&levelReportValidator](Level level) { levelReportValidator.processLevel(level); };
+	auto finishReport = [&levelReportValidator, &numbersOfValidReports]() { levelReportValidator.finishReport(numbersOfValidReports); };
+
+	// Only complete reports are processed, the incomplete last report of a block is carried over to the next one
+	std::string bufferedReports;
+	std::array<char, STREAMING_INPUT_BLOCK_SIZE_IN_BYTES> inputBlock;
+	while (inputStream)
+	{
+		inputStream.read(inputBlock.data(), inputBlock.size());
+		bufferedReports.append(inputBlock.data(), static_cast<std::size_t>(inputStream.gcount()));
+
+		const std::size_t offsetOfLastNewline = bufferedReports.rfind('\n');
+		if (offsetOfLastNewline == std::string::npos)
+			continue;
+
+		if (!processLevelReportsOfBuffer(std::string_view(bufferedReports).substr(0, offsetOfLastNewline + 1), processLevel, finishReport))
+			return std::nullopt;
+		bufferedReports.erase(0, offsetOfLastNewline + 1);
+	}
+
+	if (inputStream.bad() || !processLevelReportsOfBuffer(bufferedReports, processLevel, finishReport))
+		return std::nullopt;
+	return numbersOfValidReports;
+}
+
+std::optional<LevelAnalysis::NumbersOfValidReports> LevelAnalysis::determineNumbersOfValidReportsFromBuffer(std::string_view inputBuffer)
+{
+	NumbersOfValidReports numbersOfValidReports{ 0, 0 };
+	StreamingLevelReportValidator levelReportValidator;
+	if (!processLevelReportsOfBuffer(inputBuffer,
+		[&levelReportValidator](Level level) { levelReportValidator.processLevel(level); },
+		[&levelReportValidator, &numbersOfValidReports]() { levelReportValidator.finishReport(numbersOfValidReports); }))
+		return std::nullopt;
+	return numbersOfValidReports;
+}
+
+std::optional<LevelAnalysis::LevelReportCollection> LevelAnalysis::parseLevelReportsFromBuffer(std::string_view inputBuffer)
+{
+	LevelReportCollection levelReports;
+	if (!processLevelReportsOfBuffer(inputBuffer,
+		[&levelReports](Level level) { levelReports.appendLevelToCurrentReport(level); },
+		[&levelReports]() { levelReports.finishReport(); }))
+		return std::nullopt;
+	return levelReports;
+}
+
+template <typename LevelProcessor, typename ReportFinisher>
+bool LevelAnalysis::processLevelReportsOfBuffer(std::string_view inputBuffer, LevelProcessor&& processLevel, ReportFinisher&& finishReport)
+{
+	std::size_t currentByteOffset = 0;
+	while (currentByteOffset < inputBuffer.size())
+	{
+		Level level;
+		if (!utils::BulkNumberParser::parseNumber(inputBuffer, currentByteOffset, level))
+			return false;
+
+		processLevel(level);
+		if (currentByteOffset == inputBuffer.size())
+		{
+			finishReport();
+			break;
+		}
+
+		char levelDelimiter = inputBuffer[currentByteOffset++];
+		#if defined(_WIN32) || defined(_WIN64)
+			if (levelDelimiter == '\r' && currentByteOffset < inputBuffer.size())
+				levelDelimiter = inputBuffer[currentByteOffset++] == '\n' ? '\n' : levelDelimiter;
+		#endif
+
+		if (levelDelimiter == '\n')
+			finishReport();
+		// A report can neither end with a space nor can levels be separated by more than one space
+		else if (levelDelimiter != ' ' || currentByteOffset == inputBuffer.size())
+			return false;
+	}
+	return true;
+}
+
 std::optional<std::size_t> LevelAnalysis::determineNumberOfValidReports(const std::string& inputFileNamePath)
 {
-	if (const std::optional<LevelReportCollection> processedLevelReports = parseInputData(inputFileNamePath); processedLevelReports.has_value())
-		return determineNumberOfValidReports(*processedLevelReports);
+	if (const std::optional<NumbersOfValidReports> numbersOfValidReports = determineNumbersOfValidReports(inputFileNamePath); numbersOfValidReports.has_value())
+		return numbersOfValidReports->numValidReports;
 	return std::nullopt;
 }
 
 std::size_t LevelAnalysis::determineNumberOfValidReports(const LevelReportCollection& inputLevelReports)
 {
-	return determineNumberOfValidReports(inputLevelReports, false);
+	return countValidReports(inputLevelReports, false, 1);
+}
+
+std::optional<std::size_t> LevelAnalysis::determineNumberOfValidReportsFromBuffer(std::string_view inputBuffer)
+{
+	if (const std::optional<NumbersOfValidReports> numbersOfValidReports = determineNumbersOfValidReportsFromBuffer(inputBuffer); numbersOfValidReports.has_value())
+		return numbersOfValidReports->numValidReports;
+	return std::nullopt;
 }
 
 std::optional<std::size_t> LevelAnalysis::determineNumberOfValidReportsAllowingOneFaultyLevel(const std::string& inputFileNamePath)
 {
-	if (const std::optional<LevelReportCollection> processedLevelReports = parseInputData(inputFileNamePath); processedLevelReports.has_value())
-		return determineNumberOfValidReportsAllowingOneFaultyLevel(*processedLevelReports);
+	if (const std::optional<NumbersOfValidReports> numbersOfValidReports = determineNumbersOfValidReports(inputFileNamePath); numbersOfValidReports.has_value())
+		return numbersOfValidReports->numValidReportsAllowingOneFaultyLevel;
+	return std::nullopt;
+}
+
+std::optional<std::size_t> LevelAnalysis::determineNumberOfValidReportsAllowingOneFaultyLevelFromBuffer(std::string_view inputBuffer)
+{
+	if (const std::optional<NumbersOfValidReports> numbersOfValidReports = determineNumbersOfValidReportsFromBuffer(inputBuffer); numbersOfValidReports.has_value())
+		return numbersOfValidReports->numValidReportsAllowingOneFaultyLevel;
 	return std::nullopt;
 }
 
 std::size_t LevelAnalysis::determineNumberOfValidReportsAllowingOneFaultyLevel(const LevelReportCollection& inputLevelReports)
 {
-	return determineNumberOfValidReports(inputLevelReports, true);
+	return countValidReports(inputLevelReports, true, 1);
 }
 
+std::size_t LevelAnalysis::determineNumberOfValidReports(const LevelReportCollection& inputLevelReports, std::size_t numThreads)
+{
+	return countValidReports(inputLevelReports, false, numThreads);
+}
 
-std::size_t LevelAnalysis::determineNumberOfValidReports(const LevelReportCollection& userLevelReport, bool allowOneFaultyLevel)
+std::size_t LevelAnalysis::determineNumberOfValidReportsAllowingOneFaultyLevel(const LevelReportCollection& inputLevelReports, std::size_t numThreads)
 {
-	return std::count_if(userLevelReport.cbegin(), userLevelReport.cend(), 
-		[allowOneFaultyLevel](const LevelReport& report)
-		{
-			return !allowOneFaultyLevel ? isUserLevelReportValid(report) : isUserLevelReportValidAllowingOneFaultyLevel(report);
-		});
+	return countValidReports(inputLevelReports, true, numThreads);
 }
 
-std::optional<LevelAnalysis::LevelReportCollection> LevelAnalysis::parseInputData(const std::string& inputFileNamePath)
+std::size_t LevelAnalysis::determineNumberOfValidReportsAllowingFaultyLevels(const LevelReportCollection& inputLevelReports, std::size_t maxNumFaultyLevels)
 {
-	std::ifstream inputStream(inputFileNamePath, std::ios::binary);
-	if (!inputStream.is_open())
+	std::size_t numValidReports = 0;
+	std::vector<std::size_t> minNumRemovedLevelsKeepingLevel;
+	for (std::size_t reportIndex = 0; reportIndex < inputLevelReports.size(); ++reportIndex)
+	{
+		const LevelReport levelReport = inputLevelReports[reportIndex];
+		numValidReports += isReportValidAllowingFaultyLevelsInDirection(levelReport, maxNumFaultyLevels, 1, minNumRemovedLevelsKeepingLevel)
+			|| isReportValidAllowingFaultyLevelsInDirection(levelReport, maxNumFaultyLevels, -1, minNumRemovedLevelsKeepingLevel);
+	}
+	return numValidReports;
+}
+
+LevelAnalysis::LevelReportVerdictBitmaps LevelAnalysis::determineVerdictsOfReports(const LevelReportCollection& inputLevelReports, std::size_t numThreads)
+{
+	return determineVerdictsOfReportsInParallel(inputLevelReports, numThreads);
+}
+
+std::optional<LevelAnalysis::DeltaEncodedLevelReportCollection> LevelAnalysis::parseDeltaEncodedLevelReportsFromBuffer(std::string_view inputBuffer)
+{
+	DeltaEncodedLevelReportCollection levelReports;
+	if (!processLevelReportsOfBuffer(inputBuffer,
+		[&levelReports](Level level) { levelReports.appendLevelToCurrentReport(level); },
+		[&levelReports]() { levelReports.finishReport(); }))
 		return std::nullopt;
+	return levelReports;
+}
+
+std::size_t LevelAnalysis::determineNumberOfValidReports(const DeltaEncodedLevelReportCollection& inputLevelReports, std::size_t numThreads)
+{
+	return countValidReports(inputLevelReports, false, numThreads);
+}
+
+std::size_t LevelAnalysis::determineNumberOfValidReportsAllowingOneFaultyLevel(const DeltaEncodedLevelReportCollection& inputLevelReports, std::size_t numThreads)
+{
+	return countValidReports(inputLevelReports, true, numThreads);
+}
 
-	Level currLevel = 0;
-	char lastProcessedCharacter;
+LevelAnalysis::LevelReportVerdictBitmaps LevelAnalysis::determineVerdictsOfReports(const DeltaEncodedLevelReportCollection& inputLevelReports, std::size_t numThreads)
+{
+	return determineVerdictsOfReportsInParallel(inputLevelReports, numThreads);
+}
 
-	std::size_t numDigits = 0;
-	LevelReport lastProcessedLevelReport;
-	LevelReportCollection processedLevelReports;
-	bool processedNoneWhitespaceCharacter = false;
+template <typename LevelReports>
+LevelAnalysis::LevelReportVerdictBitmaps LevelAnalysis::determineVerdictsOfReportsInParallel(const LevelReports& levelReports, std::size_t numThreads)
+{
+	const std::size_t numBatches = (levelReports.size() + NUM_REPORTS_PER_BATCH - 1) / NUM_REPORTS_PER_BATCH;
+	LevelReportVerdictBitmaps levelReportVerdictBitmaps{ levelReports.size(), std::vector<LevelReportVerdictMask>(numBatches, 0), std::vector<LevelReportVerdictMask>(numBatches, 0) };
 
-	while ((lastProcessedCharacter = static_cast<char>(inputStream.get())) != EOF)
+	// Since the chunks are batch aligned every thread writes a distinct range of verdict masks
+	processReportChunksInParallel(levelReports.size(), numThreads, [&](std::size_t, std::size_t firstReportIndex, std::size_t lastReportIndex)
 	{
-		processedNoneWhitespaceCharacter |= !std::isspace(lastProcessedCharacter);
-		switch (lastProcessedCharacter)
+		LevelReportBatch levelReportBatch;
+		for (std::size_t firstReportIndexOfBatch = firstReportIndex; firstReportIndexOfBatch < lastReportIndex; firstReportIndexOfBatch += NUM_REPORTS_PER_BATCH)
 		{
-			case '\r': {
-				#if defined(_WIN32) || defined(_WIN64)
-					continue;
-				#else
-					return std::nullopt;
-				#endif
-			}
-			case '\n':
-			case ' ': {
-				if (!processedNoneWhitespaceCharacter)
-					return std::nullopt;
-
-				lastProcessedLevelReport.emplace_back(currLevel);
-				if (lastProcessedCharacter == '\n')
-				{
-					processedLevelReports.emplace_back(lastProcessedLevelReport);
-					lastProcessedLevelReport.clear();
-				}
-
-				currLevel = 0;
-				numDigits = 0;
-
-				processedNoneWhitespaceCharacter = false;
-				continue;
-			}
+			loadLevelReportBatch(levelReports, firstReportIndexOfBatch, lastReportIndex, levelReportBatch);
+			const LevelReportBatchVerdicts levelReportBatchVerdicts = validateLevelReportBatch(levelReportBatch);
+			levelReportVerdictBitmaps.validReports[firstReportIndexOfBatch / NUM_REPORTS_PER_BATCH] = levelReportBatchVerdicts.validReports;
+			levelReportVerdictBitmaps.validReportsAllowingOneFaultyLevel[firstReportIndexOfBatch / NUM_REPORTS_PER_BATCH] = levelReportBatchVerdicts.validReportsAllowingOneFaultyLevel;
 		}
+	});
+	return levelReportVerdictBitmaps;
+}
 
-		if (!std::isdigit(lastProcessedCharacter))
-			return std::nullopt;
-
-		currLevel *= !numDigits++ ? 1 : 10;
-		currLevel += lastProcessedCharacter - '0';
-	}
+template <typename LevelReports>
+std::size_t LevelAnalysis::countValidReports(const LevelReports& levelReports, bool allowOneFaultyLevel, std::size_t numThreads)
+{
+	std::vector<NumValidReportsOfThread> numValidReportsPerThread(std::max<std::size_t>(1, numThreads ? numThreads : std::thread::hardware_concurrency()), NumValidReportsOfThread{ 0 });
+	const std::size_t numUsedThreads = processReportChunksInParallel(levelReports.size(), numValidReportsPerThread.size(), [&](std::size_t threadIndex, std::size_t firstReportIndex, std::size_t lastReportIndex)
+	{
+		numValidReportsPerThread[threadIndex].numValidReports = countValidReportsInRange(levelReports, allowOneFaultyLevel, firstReportIndex, lastReportIndex);
+	});
 
-	lastProcessedLevelReport.emplace_back(currLevel);
-	processedLevelReports.emplace_back(lastProcessedLevelReport);
-	return processedLevelReports;
+	std::size_t numValidReports = 0;
+	for (std::size_t threadIndex = 0; threadIndex < numUsedThreads; ++threadIndex)
+		numValidReports += numValidReportsPerThread[threadIndex].numValidReports;
+	return numValidReports;
 }
 
-inline LevelAnalysis::LevelDifference LevelAnalysis::determineSignOfLevelDifference(Level lLevel, Level rLevel) noexcept
+template <typename ReportChunkProcessor>
+std::size_t LevelAnalysis::processReportChunksInParallel(std::size_t numReports, std::size_t numThreads, ReportChunkProcessor&& processReportChunk)
 {
-	if (lLevel == rLevel)
-		return LevelDifference::Equal;
+	if (!numThreads)
+		numThreads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+	numThreads = std::max<std::size_t>(1, std::min(numThreads, numReports / MIN_NUM_REPORTS_PER_THREAD));
+
+	// The chunks are aligned to the batch size to only process complete batches in all but the last chunk
+	const std::size_t numReportsPerThread = (numReports / numThreads) / NUM_REPORTS_PER_BATCH * NUM_REPORTS_PER_BATCH;
+	auto processReportChunkOfThread = [&](std::size_t threadIndex)
+	{
+		const std::size_t firstReportIndex = threadIndex * numReportsPerThread;
+		const std::size_t lastReportIndex = threadIndex + 1 == numThreads ? numReports : firstReportIndex + numReportsPerThread;
+		processReportChunk(threadIndex, firstReportIndex, lastReportIndex);
+	};
+
+	std::vector<std::thread> workerThreads;
+	workerThreads.reserve(numThreads - 1);
+	for (std::size_t threadIndex = 1; threadIndex < numThreads; ++threadIndex)
+		workerThreads.emplace_back(processReportChunkOfThread, threadIndex);
 
-	return rLevel < lLevel ? LevelDifference::Negative : LevelDifference::Positive;
+	processReportChunkOfThread(0);
+	for (std::thread& workerThread : workerThreads)
+		workerThread.join();
+	return numThreads;
+}
+
+template <typename LevelReports>
+std::size_t LevelAnalysis::countValidReportsInRange(const LevelReports& levelReports, bool allowOneFaultyLevel, std::size_t firstReportIndex, std::size_t lastReportIndex)
+{
+	std::size_t numValidReports = 0;
+	LevelReportBatch levelReportBatch;
+	for (std::size_t firstReportIndexOfBatch = firstReportIndex; firstReportIndexOfBatch < lastReportIndex; firstReportIndexOfBatch += NUM_REPORTS_PER_BATCH)
+	{
+		loadLevelReportBatch(levelReports, firstReportIndexOfBatch, lastReportIndex, levelReportBatch);
+		const LevelReportBatchVerdicts levelReportBatchVerdicts = validateLevelReportBatch(levelReportBatch);
+		numValidReports += std::bitset<NUM_REPORTS_PER_BATCH>(!allowOneFaultyLevel ? levelReportBatchVerdicts.validReports : levelReportBatchVerdicts.validReportsAllowingOneFaultyLevel).count();
+	}
+	return numValidReports;
 }
 
-bool LevelAnalysis::isUserLevelReportValid(const LevelReport& levelReport) noexcept
+template <typename LevelReports>
+void LevelAnalysis::loadLevelReportBatch(const LevelReports& levelReports, std::size_t firstReportIndex, std::size_t lastReportIndex, LevelReportBatch& levelReportBatch)
 {
-	const auto expectedLevelDifferenceSign = levelReport.size() >= 2
-		? determineSignOfLevelDifference(levelReport.front(), levelReport[1])
-		: LevelDifference::Equal;
+	levelReportBatch.numReports = std::min(NUM_REPORTS_PER_BATCH, lastReportIndex - firstReportIndex);
+	levelReportBatch.maxNumLevels = 0;
+	levelReportBatch.numLevels.fill(0);
+	for (std::size_t reportIndex = 0; reportIndex < levelReportBatch.numReports; ++reportIndex)
+	{
+		levelReportBatch.numLevels[reportIndex] = static_cast<std::uint32_t>(levelReports[firstReportIndex + reportIndex].size());
+		levelReportBatch.maxNumLevels = std::max<std::size_t>(levelReportBatch.maxNumLevels, levelReportBatch.numLevels[reportIndex]);
+	}
 
-	bool isReportValid = expectedLevelDifferenceSign != LevelDifference::Equal;
-	for (std::size_t i = 0; i < levelReport.size() - 1 && isReportValid; ++i)
+	// Positions after the last level of a report are padded with zeros which are ignored by the validation
+	const std::size_t numInterleavedDifferences = levelReportBatch.maxNumLevels * NUM_REPORTS_PER_BATCH;
+	levelReportBatch.adjacentLevelDifferences.assign(numInterleavedDifferences, 0);
+	levelReportBatch.skippingLevelDifferences.assign(numInterleavedDifferences, 0);
+	for (std::size_t reportIndex = 0; reportIndex < levelReportBatch.numReports; ++reportIndex)
 	{
-		const Level lLevel = levelReport[i];
-		const Level rLevel = levelReport[i + 1];
-		const LevelDifference currLevelDifference = determineSignOfLevelDifference(lLevel, rLevel);
-		isReportValid = currLevelDifference == expectedLevelDifferenceSign && isLevelDifferenceBelowLimit(currLevelDifference, lLevel, rLevel);
+		std::size_t index = reportIndex;
+		LevelDifference previousLevelDifference = 0;
+		levelReports[firstReportIndex + reportIndex].forEachLevelDifference([&](LevelDifference levelDifference)
+		{
+			levelReportBatch.adjacentLevelDifferences[index] = determineClampedLevelDifference(levelDifference);
+			if (index >= NUM_REPORTS_PER_BATCH)
+				levelReportBatch.skippingLevelDifferences[index] = determineClampedLevelDifference(previousLevelDifference + levelDifference);
+
+			previousLevelDifference = levelDifference;
+			index += NUM_REPORTS_PER_BATCH;
+		});
 	}
-	return isReportValid;
 }
 
-bool LevelAnalysis::isUserLevelReportValidAllowingOneFaultyLevel(const LevelReport& levelReport) noexcept
+LevelAnalysis::LevelReportBatchVerdicts LevelAnalysis::validateLevelReportBatch(LevelReportBatch& levelReportBatch) noexcept
 {
-	if (levelReport.size() < 2)
-		return false;
+	const LevelReportBatchVerdicts ascendingLevelsVerdicts = validateLevelReportBatchInDirection(levelReportBatch, 1);
+	const LevelReportBatchVerdicts descendingLevelsVerdicts = validateLevelReportBatchInDirection(levelReportBatch, -1);
+	return LevelReportBatchVerdicts{
+		static_cast<LevelReportBatchVerdictMask>(ascendingLevelsVerdicts.validReports | descendingLevelsVerdicts.validReports),
+		static_cast<LevelReportBatchVerdictMask>(ascendingLevelsVerdicts.validReportsAllowingOneFaultyLevel | descendingLevelsVerdicts.validReportsAllowingOneFaultyLevel)
+	};
+}
+
+/// A report is valid if all its level differences are within the limits, with one faulty level allowed the report is valid if the removal of a single level results in a valid report.
+/// The removal of the level at position i is valid if all differences in front of position i - 1 as well as after position i are within the limits and the difference between the levels
+/// at the positions i - 1 and i + 1 replacing the two differences involving the removed level is within the limits. Reports with less than two levels are considered to be invalid.
+/// With SSE2 the eight interleaved lanes of a position are processed as one 64-bit vector, the lanes are range checked using signed byte comparisons, combined into lane masks and
+/// reduced to the verdict masks using a movemask. Without SSE2 the lanes are processed one at a time by scalar loops.
+LevelAnalysis::LevelReportBatchVerdicts LevelAnalysis::validateLevelReportBatchInDirection(LevelReportBatch& levelReportBatch, ClampedLevelDifference direction) noexcept
+{
+	const std::size_t numLevelPositions = levelReportBatch.maxNumLevels;
+	const std::size_t numDifferencePositions = numLevelPositions ? numLevelPositions - 1 : 0;
+	const std::array<std::uint32_t, NUM_REPORTS_PER_BATCH>& numLevels = levelReportBatch.numLevels;
+	const ClampedLevelDifference* __restrict adjacentLevelDifferences = levelReportBatch.adjacentLevelDifferences.data();
+	const ClampedLevelDifference* __restrict skippingLevelDifferences = levelReportBatch.skippingLevelDifferences.data();
+
+	levelReportBatch.areDifferencesInPrefixValid.resize((numDifferencePositions + 1) * NUM_REPORTS_PER_BATCH);
+	levelReportBatch.areDifferencesInSuffixValid.resize((numDifferencePositions + 1) * NUM_REPORTS_PER_BATCH);
+	std::uint8_t* __restrict areDifferencesInPrefixValid = levelReportBatch.areDifferencesInPrefixValid.data();
+	std::uint8_t* __restrict areDifferencesInSuffixValid = levelReportBatch.areDifferencesInSuffixValid.data();
+
+#ifdef DAY02_SSE2_BATCH_KERNEL_AVAILABLE
+	// The lane masks hold all bits of the lane of a report set if the condition holds for the report, the upper half of the 128-bit vectors is unused
+	const __m128i noLanes = _mm_setzero_si128();
+	const __m128i allLanes = _mm_set1_epi8(-1);
+	const __m128i lowerExclusiveLimit = _mm_set1_epi8(static_cast<char>(direction > 0 ? MIN_ALLOWED_LEVEL_DIFFERENCE - 1 : -MAX_ALLOWED_LEVEL_DIFFERENCE - 1));
+	const __m128i upperExclusiveLimit = _mm_set1_epi8(static_cast<char>(direction > 0 ? MAX_ALLOWED_LEVEL_DIFFERENCE + 1 : -MIN_ALLOWED_LEVEL_DIFFERENCE + 1));
+	const __m128i numLevelsOfFirstReports = _mm_loadu_si128(reinterpret_cast<const __m128i*>(numLevels.data()));
+	const __m128i numLevelsOfLastReports = _mm_loadu_si128(reinterpret_cast<const __m128i*>(numLevels.data() + NUM_REPORTS_PER_BATCH / 2));
 
-	std::size_t lLevelIndex = 0;
-	std::size_t rLevelIndex = 1;
-	bool faultyLevelFound = false;
-	const auto initialExpectedLevelDifferenceSign = determineSignOfLevelDifference(levelReport[lLevelIndex], levelReport[rLevelIndex]);
+	// The signed comparison of the number of levels is sufficient since no report consists of 2^31 or more levels
+	auto determineLanesOfReportsWithMoreLevelsThan = [&](std::size_t numLevelsThreshold)
+	{
+		const __m128i repeatedNumLevelsThreshold = _mm_set1_epi32(static_cast<int>(numLevelsThreshold));
+		const __m128i lanesOfFirstReports = _mm_cmpgt_epi32(numLevelsOfFirstReports, repeatedNumLevelsThreshold);
+		const __m128i lanesOfLastReports = _mm_cmpgt_epi32(numLevelsOfLastReports, repeatedNumLevelsThreshold);
+		return _mm_packs_epi16(_mm_packs_epi32(lanesOfFirstReports, lanesOfLastReports), noLanes);
+	};
+	auto determineLanesOfDifferencesWithinLimits = [&](const ClampedLevelDifference* levelDifferences)
+	{
+		const __m128i levelDifferencesOfPosition = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(levelDifferences));
+		return _mm_and_si128(_mm_cmpgt_epi8(levelDifferencesOfPosition, lowerExclusiveLimit), _mm_cmpgt_epi8(upperExclusiveLimit, levelDifferencesOfPosition));
+	};
+	auto loadLanes = [](const std::uint8_t* laneMasks) { return _mm_loadl_epi64(reinterpret_cast<const __m128i*>(laneMasks)); };
+	auto storeLanes = [](std::uint8_t* laneMasks, __m128i lanes) { _mm_storel_epi64(reinterpret_cast<__m128i*>(laneMasks), lanes); };
 
-	LevelAnalysis::LevelDifference expectedLevelDifferenceSign = initialExpectedLevelDifferenceSign;
-	// Report of form |3 7 ...| or |3 4 ...| was found which moves indices one position to the right (difference above limit sets flag)
-	if (initialExpectedLevelDifferenceSign == LevelDifference::Positive)
+	// Padded differences after the last level of a report are always considered to be valid
+	__m128i areDifferencesInPrefixValidLanes = allLanes;
+	storeLanes(areDifferencesInPrefixValid, allLanes);
+	for (std::size_t position = 0; position < numDifferencePositions; ++position)
 	{
-		faultyLevelFound = !isLevelDifferenceBelowLimit(LevelDifference::Positive, levelReport[lLevelIndex], levelReport[rLevelIndex]);
-		++lLevelIndex;
-		++rLevelIndex;
+		const __m128i isPaddedDifference = _mm_cmpeq_epi8(determineLanesOfReportsWithMoreLevelsThan(position + 1), noLanes);
+		areDifferencesInPrefixValidLanes = _mm_and_si128(areDifferencesInPrefixValidLanes, _mm_or_si128(determineLanesOfDifferencesWithinLimits(adjacentLevelDifferences + position * NUM_REPORTS_PER_BATCH), isPaddedDifference));
+		storeLanes(areDifferencesInPrefixValid + (position + 1) * NUM_REPORTS_PER_BATCH, areDifferencesInPrefixValidLanes);
 	}
-	// Report of form |7 3 ...| or |7 6 ...| was found which moves indices right index on position to the right if the difference limit was exceeded
-	else if (initialExpectedLevelDifferenceSign == LevelDifference::Negative)
+
+	__m128i areDifferencesInSuffixValidLanes = allLanes;
+	storeLanes(areDifferencesInSuffixValid + numDifferencePositions * NUM_REPORTS_PER_BATCH, allLanes);
+	for (std::size_t position = numDifferencePositions; position-- > 0;)
 	{
-		faultyLevelFound = !isLevelDifferenceBelowLimit(LevelDifference::Negative, levelReport[lLevelIndex], levelReport[rLevelIndex]);
-		lLevelIndex += !faultyLevelFound;
-		++rLevelIndex;
+		const __m128i isPaddedDifference = _mm_cmpeq_epi8(determineLanesOfReportsWithMoreLevelsThan(position + 1), noLanes);
+		areDifferencesInSuffixValidLanes = _mm_and_si128(areDifferencesInSuffixValidLanes, _mm_or_si128(determineLanesOfDifferencesWithinLimits(adjacentLevelDifferences + position * NUM_REPORTS_PER_BATCH), isPaddedDifference));
+		storeLanes(areDifferencesInSuffixValid + position * NUM_REPORTS_PER_BATCH, areDifferencesInSuffixValidLanes);
 	}
-	// Level equivalence sets 'faulty' flag and moves both internal indices one position to the right
-	else if (initialExpectedLevelDifferenceSign == LevelDifference::Equal)
+
+	__m128i isValidAfterRemovalOfAnyLevel = noLanes;
+	__m128i isLevelOfReport = determineLanesOfReportsWithMoreLevelsThan(0);
+	for (std::size_t removedLevelPosition = 0; removedLevelPosition < numLevelPositions; ++removedLevelPosition)
 	{
-		faultyLevelFound = true;
-		++lLevelIndex;
-		++rLevelIndex;
-		expectedLevelDifferenceSign = levelReport.size() > 2
-			? determineSignOfLevelDifference(levelReport[lLevelIndex], levelReport[rLevelIndex])
-			: initialExpectedLevelDifferenceSign;
+		const __m128i isFollowedByLevelOfReport = determineLanesOfReportsWithMoreLevelsThan(removedLevelPosition + 1);
+		const __m128i isInnerLevel = removedLevelPosition ? isFollowedByLevelOfReport : noLanes;
+		const __m128i isPrefixValid = removedLevelPosition ? loadLanes(areDifferencesInPrefixValid + (removedLevelPosition - 1) * NUM_REPORTS_PER_BATCH) : allLanes;
+		const __m128i isSuffixValid = loadLanes(areDifferencesInSuffixValid + std::min(removedLevelPosition + 1, numDifferencePositions) * NUM_REPORTS_PER_BATCH);
+		const __m128i isSkippingDifferenceValid = _mm_or_si128(_mm_cmpeq_epi8(isInnerLevel, noLanes), determineLanesOfDifferencesWithinLimits(skippingLevelDifferences + removedLevelPosition * NUM_REPORTS_PER_BATCH));
+		isValidAfterRemovalOfAnyLevel = _mm_or_si128(isValidAfterRemovalOfAnyLevel, _mm_and_si128(_mm_and_si128(isLevelOfReport, isPrefixValid), _mm_and_si128(isSkippingDifferenceValid, isSuffixValid)));
+		isLevelOfReport = isFollowedByLevelOfReport;
 	}
 
-	bool isReportValid = true;
-	for (std::size_t i = rLevelIndex; i <= levelReport.size() - 1 && isReportValid; ++i)
+	const int validReports = _mm_movemask_epi8(_mm_and_si128(areDifferencesInPrefixValidLanes, determineLanesOfReportsWithMoreLevelsThan(1)));
+	const int validReportsAfterRemovalOfAnyLevel = _mm_movemask_epi8(_mm_and_si128(isValidAfterRemovalOfAnyLevel, determineLanesOfReportsWithMoreLevelsThan(2)));
+	return LevelReportBatchVerdicts{ static_cast<LevelReportBatchVerdictMask>(validReports), static_cast<LevelReportBatchVerdictMask>(validReports | validReportsAfterRemovalOfAnyLevel) };
+#else
+	auto isDifferenceWithinLimits = [direction](ClampedLevelDifference levelDifference) -> std::uint8_t
+	{
+		const int directedLevelDifference = levelDifference * direction;
+		return (directedLevelDifference >= MIN_ALLOWED_LEVEL_DIFFERENCE) & (directedLevelDifference <= MAX_ALLOWED_LEVEL_DIFFERENCE);
+	};
+
+	for (std::size_t reportIndex = 0; reportIndex < NUM_REPORTS_PER_BATCH; ++reportIndex)
 	{
-		const Level lLevel = levelReport[lLevelIndex];
-		const Level rLevel = levelReport[rLevelIndex];
-		const LevelDifference currLevelDifference = determineSignOfLevelDifference(lLevel, rLevel);
-		isReportValid = currLevelDifference == expectedLevelDifferenceSign && isLevelDifferenceBelowLimit(currLevelDifference, lLevel, rLevel);
+		areDifferencesInPrefixValid[reportIndex] = 1;
+		areDifferencesInSuffixValid[numDifferencePositions * NUM_REPORTS_PER_BATCH + reportIndex] = 1;
+	}
 
-		if (!isReportValid)
+	// Padded differences after the last level of a report are always considered to be valid
+	for (std::size_t position = 0; position < numDifferencePositions; ++position)
+	{
+		for (std::size_t reportIndex = 0; reportIndex < NUM_REPORTS_PER_BATCH; ++reportIndex)
 		{
-			isReportValid = !faultyLevelFound;
-			faultyLevelFound = true;
-			++rLevelIndex;
+			const std::size_t index = position * NUM_REPORTS_PER_BATCH + reportIndex;
+			const std::uint8_t isPaddedDifference = position + 1 >= numLevels[reportIndex];
+			areDifferencesInPrefixValid[index + NUM_REPORTS_PER_BATCH] = areDifferencesInPrefixValid[index] & (isDifferenceWithinLimits(adjacentLevelDifferences[index]) | isPaddedDifference);
 		}
-		else
+	}
+
+	for (std::size_t position = numDifferencePositions; position-- > 0;)
+	{
+		for (std::size_t reportIndex = 0; reportIndex < NUM_REPORTS_PER_BATCH; ++reportIndex)
 		{
-			++rLevelIndex;
-			lLevelIndex = rLevelIndex - 1;
+			const std::size_t index = position * NUM_REPORTS_PER_BATCH + reportIndex;
+			const std::uint8_t isPaddedDifference = position + 1 >= numLevels[reportIndex];
+			areDifferencesInSuffixValid[index] = areDifferencesInSuffixValid[index + NUM_REPORTS_PER_BATCH] & (isDifferenceWithinLimits(adjacentLevelDifferences[index]) | isPaddedDifference);
 		}
 	}
-	return isReportValid;
+
+	std::array<std::uint8_t, NUM_REPORTS_PER_BATCH> isValidAfterRemovalOfAnyLevel{};
+	for (std::size_t removedLevelPosition = 0; removedLevelPosition < numLevelPositions; ++removedLevelPosition)
+	{
+		const std::size_t prefixIndex = removedLevelPosition ? (removedLevelPosition - 1) * NUM_REPORTS_PER_BATCH : 0;
+		const std::size_t suffixIndex = std::min(removedLevelPosition + 1, numDifferencePositions) * NUM_REPORTS_PER_BATCH;
+		const std::size_t skippingDifferenceIndex = removedLevelPosition * NUM_REPORTS_PER_BATCH;
+		for (std::size_t reportIndex = 0; reportIndex < NUM_REPORTS_PER_BATCH; ++reportIndex)
+		{
+			const std::uint8_t isLevelOfReport = removedLevelPosition < numLevels[reportIndex];
+			const std::uint8_t isInnerLevel = (removedLevelPosition > 0) & (removedLevelPosition + 1 < numLevels[reportIndex]);
+			const std::uint8_t isPrefixValid = removedLevelPosition ? areDifferencesInPrefixValid[prefixIndex + reportIndex] : 1;
+			const std::uint8_t isSkippingDifferenceValid = static_cast<std::uint8_t>(!isInnerLevel) | isDifferenceWithinLimits(skippingLevelDifferences[skippingDifferenceIndex + reportIndex]);
+			isValidAfterRemovalOfAnyLevel[reportIndex] |= isLevelOfReport & isPrefixValid & isSkippingDifferenceValid & areDifferencesInSuffixValid[suffixIndex + reportIndex];
+		}
+	}
+
+	LevelReportBatchVerdicts levelReportBatchVerdicts{ 0, 0 };
+	for (std::size_t reportIndex = 0; reportIndex < NUM_REPORTS_PER_BATCH; ++reportIndex)
+	{
+		const bool isValid = numLevels[reportIndex] >= 2 && areDifferencesInPrefixValid[numDifferencePositions * NUM_REPORTS_PER_BATCH + reportIndex];
+		const bool isValidAllowingOneFaultyLevel = isValid || (numLevels[reportIndex] >= 3 && isValidAfterRemovalOfAnyLevel[reportIndex]);
+		levelReportBatchVerdicts.validReports |= static_cast<LevelReportBatchVerdictMask>(isValid << reportIndex);
+		levelReportBatchVerdicts.validReportsAllowingOneFaultyLevel |= static_cast<LevelReportBatchVerdictMask>(isValidAllowingOneFaultyLevel << reportIndex);
+	}
+	return levelReportBatchVerdicts;
+#endif
+}
+
+inline LevelAnalysis::ClampedLevelDifference LevelAnalysis::determineClampedLevelDifference(Level lLevel, Level rLevel) noexcept
+{
+	return determineClampedLevelDifference(static_cast<LevelDifference>(rLevel) - static_cast<LevelDifference>(lLevel));
+}
+
+inline LevelAnalysis::ClampedLevelDifference LevelAnalysis::determineClampedLevelDifference(LevelDifference levelDifference) noexcept
+{
+	return static_cast<ClampedLevelDifference>(std::clamp<LevelDifference>(levelDifference, -MAX_TRACKED_LEVEL_DIFFERENCE, MAX_TRACKED_LEVEL_DIFFERENCE));
+}
+
+/// The minimum number of removed levels of a valid prefix whose last kept level is the level at position j is either j (all previous levels are removed) or the minimum over the at most
+/// maxNumFaultyLevels + 1 preceding positions i with a valid difference to the level at position j of the value at position i plus the j - i - 1 levels removed between them.
+/// The report is valid if any position j combined with the removal of all following levels requires at most maxNumFaultyLevels removals while keeping at least two levels.
+bool LevelAnalysis::isReportValidAllowingFaultyLevelsInDirection(const LevelReport& levelReport, std::size_t maxNumFaultyLevels, ClampedLevelDifference direction, std::vector<std::size_t>& minNumRemovedLevelsKeepingLevel)
+{
+	const std::size_t numLevels = levelReport.size();
+	if (numLevels < 2)
+		return false;
+
+	const std::size_t maxNumRemovedLevels = std::min(maxNumFaultyLevels, numLevels - 2);
+	minNumRemovedLevelsKeepingLevel.resize(numLevels);
+	for (std::size_t j = 0; j < numLevels; ++j)
+	{
+		std::size_t minNumRemovedLevels = j;
+		for (std::size_t i = j > maxNumRemovedLevels + 1 ? j - maxNumRemovedLevels - 1 : 0; i < j; ++i)
+		{
+			if (isLevelDifferenceWithinLimits(levelReport[i], levelReport[j], direction))
+				minNumRemovedLevels = std::min(minNumRemovedLevels, minNumRemovedLevelsKeepingLevel[i] + (j - i - 1));
+		}
+		minNumRemovedLevelsKeepingLevel[j] = minNumRemovedLevels;
+
+		if (j + maxNumRemovedLevels + 1 >= numLevels && minNumRemovedLevels + (numLevels - 1 - j) <= maxNumRemovedLevels)
+			return true;
+	}
+	return false;
+}
+
+LevelAnalysis::StreamingLevelReportValidator::StreamingLevelReportValidator() noexcept
+	: numLevels(0), previousLevel(0), secondPreviousLevel(0),
+	  ascendingLevelsState({ true, false, false }), descendingLevelsState({ true, false, false }) {}
+
+void LevelAnalysis::StreamingLevelReportValidator::processLevel(Level level) noexcept
+{
+	processLevelInDirection(level, 1, ascendingLevelsState);
+	processLevelInDirection(level, -1, descendingLevelsState);
+	secondPreviousLevel = previousLevel;
+	previousLevel = level;
+	++numLevels;
+}
+
+void LevelAnalysis::StreamingLevelReportValidator::finishReport(NumbersOfValidReports& numbersOfValidReports) noexcept
+{
+	// Reports with less than two levels are considered to be invalid and at least two levels need to remain after the removal of a faulty one
+	const bool isValid = numLevels >= 2 && (ascendingLevelsState.isValid || descendingLevelsState.isValid);
+	const bool isValidAfterRemovalOfAnyLevel = numLevels >= 3 && (
+		ascendingLevelsState.isValidAfterRemovalOfEarlierLevel || ascendingLevelsState.isValidAfterRemovalOfLastLevel
+		|| descendingLevelsState.isValidAfterRemovalOfEarlierLevel || descendingLevelsState.isValidAfterRemovalOfLastLevel);
+
+	numbersOfValidReports.numValidReports += isValid;
+	numbersOfValidReports.numValidReportsAllowingOneFaultyLevel += isValid || isValidAfterRemovalOfAnyLevel;
+	*this = StreamingLevelReportValidator();
+}
+
+/// The removal of an earlier level keeps the processed level as the last one of the report, its predecessor is either the previous level or, if the previous level itself was removed, the second previous one.
+/// Removing the processed level requires all previous differences to be valid with the previous level becoming the last one of the report.
+void LevelAnalysis::StreamingLevelReportValidator::processLevelInDirection(Level level, ClampedLevelDifference direction, ValidationStateInDirection& validationState) const noexcept
+{
+	if (!numLevels)
+	{
+		validationState = { true, false, true };
+		return;
+	}
+
+	const bool isDifferenceToPreviousLevelValid = isLevelDifferenceWithinLimits(previousLevel, level, direction);
+	const bool isValidAfterRemovalOfEarlierLevel = numLevels == 1
+		|| (validationState.isValidAfterRemovalOfEarlierLevel && isDifferenceToPreviousLevelValid)
+		|| (validationState.isValidAfterRemovalOfLastLevel && isLevelDifferenceWithinLimits(secondPreviousLevel, level, direction));
+
+	validationState.isValidAfterRemovalOfLastLevel = validationState.isValid;
+	validationState.isValidAfterRemovalOfEarlierLevel = isValidAfterRemovalOfEarlierLevel;
+	validationState.isValid &= isDifferenceToPreviousLevelValid;
 }
 
-inline bool LevelAnalysis::isLevelDifferenceBelowLimit(LevelDifference levelDifference, Level lLevel, Level rLevel) noexcept
+inline bool LevelAnalysis::isLevelDifferenceWithinLimits(Level lLevel, Level rLevel, ClampedLevelDifference direction) noexcept
 {
-	return (levelDifference == LevelDifference::Positive ? rLevel - lLevel : lLevel - rLevel) <= 3;
+	const int directedLevelDifference = determineClampedLevelDifference(lLevel, rLevel) * direction;
+	return directedLevelDifference >= MIN_ALLOWED_LEVEL_DIFFERENCE && directedLevelDifference <= MAX_ALLOWED_LEVEL_DIFFERENCE;
 }
 
 //int main()
@@ -1,7 +1,16 @@
 #ifndef DAY02_LEVEL_ANALYSIS_HPP
 #define DAY02_LEVEL_ANALYSIS_HPP
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <istream>
+#include <iterator>
+#include <limits>
 #include <optional>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -9,29 +18,326 @@ namespace Day02 {
 	class LevelAnalysis {
 	public:
 		using Level = uint32_t;
-		using LevelReport = std::vector<Level>;
-		using LevelReportCollection = std::vector<LevelReport>;
+		using LevelDifference = std::int64_t;
+
+		/// Non-owning view of the levels of a single report stored in a LevelReportCollection.
+		class LevelReport
+		{
+		public:
+			LevelReport(const Level* levels, std::size_t numLevels) noexcept
+				: levels(levels), numLevels(numLevels) {}
+
+			[[nodiscard]] std::size_t size() const noexcept { return numLevels; }
+			[[nodiscard]] bool empty() const noexcept { return !numLevels; }
+			[[nodiscard]] Level operator[](std::size_t levelIndex) const noexcept { return levels[levelIndex]; }
+			[[nodiscard]] Level front() const noexcept { return levels[0]; }
+			[[nodiscard]] Level back() const noexcept { return levels[numLevels - 1]; }
+			[[nodiscard]] const Level* begin() const noexcept { return levels; }
+			[[nodiscard]] const Level* end() const noexcept { return levels + numLevels; }
+
+			template <typename LevelDifferenceProcessor>
+			void forEachLevelDifference(LevelDifferenceProcessor&& processLevelDifference) const
+			{
+				for (std::size_t levelIndex = 0; levelIndex + 1 < numLevels; ++levelIndex)
+					processLevelDifference(static_cast<LevelDifference>(levels[levelIndex + 1]) - static_cast<LevelDifference>(levels[levelIndex]));
+			}
+
+		protected:
+			const Level* levels;
+			std::size_t numLevels;
+		};
+
+		/// Stores the levels of all reports in a single contiguous container with the levels of the i-th report being located in the range [reportOffsets[i], reportOffsets[i + 1]).
+		class LevelReportCollection
+		{
+		public:
+			LevelReportCollection()
+				: reportOffsets({ 0 }) {}
+
+			LevelReportCollection(std::initializer_list<std::initializer_list<Level>> levelReports)
+				: LevelReportCollection()
+			{
+				reportOffsets.reserve(levelReports.size() + 1);
+				for (const std::initializer_list<Level>& levelReport : levelReports)
+				{
+					levels.insert(levels.end(), levelReport.begin(), levelReport.end());
+					finishReport();
+				}
+			}
+
+			void appendLevelToCurrentReport(Level level)
+			{
+				levels.emplace_back(level);
+			}
+
+			/// All levels appended since the last finished report will be part of the finished report.
+			void finishReport()
+			{
+				reportOffsets.emplace_back(levels.size());
+			}
+
+			[[nodiscard]] std::size_t size() const noexcept { return reportOffsets.size() - 1; }
+			[[nodiscard]] bool empty() const noexcept { return !size(); }
+			[[nodiscard]] LevelReport operator[](std::size_t reportIndex) const noexcept
+			{
+				return LevelReport(levels.data() + reportOffsets[reportIndex], reportOffsets[reportIndex + 1] - reportOffsets[reportIndex]);
+			}
+
+		protected:
+			std::vector<Level> levels;
+			std::vector<std::size_t> reportOffsets;
+		};
+
+		struct NumbersOfValidReports
+		{
+			std::size_t numValidReports;
+			std::size_t numValidReportsAllowingOneFaultyLevel;
+		};
+
+		/// Stores the first level of every report followed by the differences between its adjacent levels as 8-bit deltas. Differences not representable by a delta are replaced by an escape
+		/// delta with the actual difference being stored in a side table ordered by the index of the escaped delta.
+		class DeltaEncodedLevelReportCollection
+		{
+		public:
+			using LevelDelta = std::int8_t;
+			static constexpr LevelDelta ESCAPED_LEVEL_DELTA = std::numeric_limits<LevelDelta>::min();
+
+			struct EscapedLevelDelta
+			{
+				std::size_t levelDeltaIndex;
+				LevelDifference levelDifference;
+			};
+
+			/// Non-owning view of the first level and the level deltas of a single report stored in a DeltaEncodedLevelReportCollection.
+			class DeltaEncodedLevelReport
+			{
+			public:
+				DeltaEncodedLevelReport(Level firstLevel, const LevelDelta* levelDeltas, std::size_t numLevels, std::size_t firstLevelDeltaIndex, const std::vector<EscapedLevelDelta>& escapedLevelDeltas) noexcept
+					: firstLevel(firstLevel), levelDeltas(levelDeltas), numLevels(numLevels), firstLevelDeltaIndex(firstLevelDeltaIndex), escapedLevelDeltas(escapedLevelDeltas) {}
+
+				[[nodiscard]] std::size_t size() const noexcept { return numLevels; }
+				[[nodiscard]] bool empty() const noexcept { return !numLevels; }
+				[[nodiscard]] Level front() const noexcept { return firstLevel; }
+
+				template <typename LevelDifferenceProcessor>
+				void forEachLevelDifference(LevelDifferenceProcessor&& processLevelDifference) const
+				{
+					auto escapedLevelDelta = escapedLevelDeltas.cend();
+					for (std::size_t levelDeltaIndex = 0; levelDeltaIndex + 1 < numLevels; ++levelDeltaIndex)
+					{
+						if (levelDeltas[levelDeltaIndex] != ESCAPED_LEVEL_DELTA)
+						{
+							processLevelDifference(static_cast<LevelDifference>(levelDeltas[levelDeltaIndex]));
+							continue;
+						}
+
+						// Only the first escaped delta of a report requires a search in the side table, the following ones are stored right after it
+						escapedLevelDelta = escapedLevelDelta == escapedLevelDeltas.cend()
+							? std::lower_bound(escapedLevelDeltas.cbegin(), escapedLevelDeltas.cend(), firstLevelDeltaIndex + levelDeltaIndex, [](const EscapedLevelDelta& escapedLevelDelta, std::size_t levelDeltaIndex) { return escapedLevelDelta.levelDeltaIndex < levelDeltaIndex; })
+							: std::next(escapedLevelDelta);
+						processLevelDifference(escapedLevelDelta->levelDifference);
+					}
+				}
+
+			protected:
+				Level firstLevel;
+				const LevelDelta* levelDeltas;
+				std::size_t numLevels;
+				std::size_t firstLevelDeltaIndex;
+				const std::vector<EscapedLevelDelta>& escapedLevelDeltas;
+			};
+
+			DeltaEncodedLevelReportCollection()
+				: levelDeltaOffsets({ 0 }), lastLevelOfCurrentReport(0), isCurrentReportEmpty(true) {}
+
+			void appendLevelToCurrentReport(Level level)
+			{
+				if (isCurrentReportEmpty)
+					firstLevels.emplace_back(level);
+				else
+				{
+					const LevelDifference levelDifference = static_cast<LevelDifference>(level) - static_cast<LevelDifference>(lastLevelOfCurrentReport);
+					if (levelDifference > std::numeric_limits<LevelDelta>::max() || levelDifference <= ESCAPED_LEVEL_DELTA)
+					{
+						escapedLevelDeltas.push_back(EscapedLevelDelta{ levelDeltas.size(), levelDifference });
+						levelDeltas.emplace_back(ESCAPED_LEVEL_DELTA);
+					}
+					else
+						levelDeltas.emplace_back(static_cast<LevelDelta>(levelDifference));
+				}
+				lastLevelOfCurrentReport = level;
+				isCurrentReportEmpty = false;
+			}
+
+			/// All levels appended since the last finished report will be part of the finished report, an empty report is stored as a report consisting of a single level of zero which is equally invalid.
+			void finishReport()
+			{
+				if (isCurrentReportEmpty)
+					firstLevels.emplace_back(0);
+				levelDeltaOffsets.emplace_back(levelDeltas.size());
+				isCurrentReportEmpty = true;
+			}
+
+			[[nodiscard]] std::size_t size() const noexcept { return levelDeltaOffsets.size() - 1; }
+			[[nodiscard]] bool empty() const noexcept { return !size(); }
+			[[nodiscard]] DeltaEncodedLevelReport operator[](std::size_t reportIndex) const noexcept
+			{
+				const std::size_t firstLevelDeltaIndex = levelDeltaOffsets[reportIndex];
+				const std::size_t numLevelDeltas = levelDeltaOffsets[reportIndex + 1] - firstLevelDeltaIndex;
+				return DeltaEncodedLevelReport(firstLevels[reportIndex], levelDeltas.data() + firstLevelDeltaIndex, numLevelDeltas + 1, firstLevelDeltaIndex, escapedLevelDeltas);
+			}
+
+		protected:
+			std::vector<Level> firstLevels;
+			std::vector<LevelDelta> levelDeltas;
+			std::vector<std::size_t> levelDeltaOffsets;
+			std::vector<EscapedLevelDelta> escapedLevelDeltas;
+			Level lastLevelOfCurrentReport;
+			bool isCurrentReportEmpty;
+		};
+
+		/// Validates every report as soon as its last level was parsed, only the last two levels of the current report are kept in memory which allows the processing of inputs larger than the available memory.
+		[[nodiscard]] static std::optional<NumbersOfValidReports> determineNumbersOfValidReports(const std::string& inputFileNamePath);
+		[[nodiscard]] static std::optional<NumbersOfValidReports> determineNumbersOfValidReports(std::istream& inputStream);
+		[[nodiscard]] static std::optional<NumbersOfValidReports> determineNumbersOfValidReportsFromBuffer(std::string_view inputBuffer);
+
+		/// Every report consists of levels separated by a single space and is terminated by a newline or the end of the buffer.
+		[[nodiscard]] static std::optional<LevelReportCollection> parseLevelReportsFromBuffer(std::string_view inputBuffer);
 
 		[[nodiscard]] static std::optional<std::size_t> determineNumberOfValidReports(const std::string& inputFileNamePath);
 		[[nodiscard]] static std::size_t determineNumberOfValidReports(const LevelReportCollection& inputLevelReports);
+		[[nodiscard]] static std::optional<std::size_t> determineNumberOfValidReportsFromBuffer(std::string_view inputBuffer);
 		[[nodiscard]] static std::optional<std::size_t> determineNumberOfValidReportsAllowingOneFaultyLevel(const std::string& inputFileNamePath);
+		[[nodiscard]] static std::optional<std::size_t> determineNumberOfValidReportsAllowingOneFaultyLevelFromBuffer(std::string_view inputBuffer);
 		[[nodiscard]] static std::size_t determineNumberOfValidReportsAllowingOneFaultyLevel(const LevelReportCollection& inputLevelReports);
+
+		/// The reports are split into equally sized chunks that are validated by separate threads (zero will use the number of hardware threads).
+		[[nodiscard]] static std::size_t determineNumberOfValidReports(const LevelReportCollection& inputLevelReports, std::size_t numThreads);
+		[[nodiscard]] static std::size_t determineNumberOfValidReportsAllowingOneFaultyLevel(const LevelReportCollection& inputLevelReports, std::size_t numThreads);
+
+		/// A report is valid if the removal of at most maxNumFaultyLevels levels results in a valid report consisting of at least two levels.
+		[[nodiscard]] static std::size_t determineNumberOfValidReportsAllowingFaultyLevels(const LevelReportCollection& inputLevelReports, std::size_t maxNumFaultyLevels);
+
+		using LevelReportVerdictMask = std::uint8_t;
+
+		/// The bit (i % 8) of the mask at index (i / 8) is set if the i-th report is valid, bits of the last mask not belonging to any report are never set.
+		struct LevelReportVerdictBitmaps
+		{
+			std::size_t numReports;
+			std::vector<LevelReportVerdictMask> validReports;
+			std::vector<LevelReportVerdictMask> validReportsAllowingOneFaultyLevel;
+
+			[[nodiscard]] bool isReportValid(std::size_t reportIndex) const noexcept
+			{
+				return (validReports[reportIndex / 8] >> (reportIndex % 8)) & 1;
+			}
+
+			[[nodiscard]] bool isReportValidAllowingOneFaultyLevel(std::size_t reportIndex) const noexcept
+			{
+				return (validReportsAllowingOneFaultyLevel[reportIndex / 8] >> (reportIndex % 8)) & 1;
+			}
+		};
+
+		/// Determines the verdicts of all reports using the same validation as the counting functions, the reports are split into chunks as described above.
+		[[nodiscard]] static LevelReportVerdictBitmaps determineVerdictsOfReports(const LevelReportCollection& inputLevelReports, std::size_t numThreads = 1);
+
+		/// The delta encoded reports are validated by the same kernel as the reports of a LevelReportCollection.
+		[[nodiscard]] static std::optional<DeltaEncodedLevelReportCollection> parseDeltaEncodedLevelReportsFromBuffer(std::string_view inputBuffer);
+		[[nodiscard]] static std::size_t determineNumberOfValidReports(const DeltaEncodedLevelReportCollection& inputLevelReports, std::size_t numThreads = 1);
+		[[nodiscard]] static std::size_t determineNumberOfValidReportsAllowingOneFaultyLevel(const DeltaEncodedLevelReportCollection& inputLevelReports, std::size_t numThreads = 1);
+		[[nodiscard]] static LevelReportVerdictBitmaps determineVerdictsOfReports(const DeltaEncodedLevelReportCollection& inputLevelReports, std::size_t numThreads = 1);
 	protected:
-		enum LevelDifference : char
+		/// Differences between levels are clamped to [-MAX_TRACKED_LEVEL_DIFFERENCE, MAX_TRACKED_LEVEL_DIFFERENCE] since any larger difference violates the limit anyways.
+		using ClampedLevelDifference = std::int8_t;
+		using LevelReportBatchVerdictMask = LevelReportVerdictMask;
+
+		static constexpr std::size_t NUM_REPORTS_PER_BATCH = 8;
+		static_assert(NUM_REPORTS_PER_BATCH == 8 * sizeof(LevelReportBatchVerdictMask), "The verdicts of a batch need to fill exactly one verdict mask");
+		static constexpr ClampedLevelDifference MIN_ALLOWED_LEVEL_DIFFERENCE = 1;
+		static constexpr ClampedLevelDifference MAX_ALLOWED_LEVEL_DIFFERENCE = 3;
+		static constexpr ClampedLevelDifference MAX_TRACKED_LEVEL_DIFFERENCE = MAX_ALLOWED_LEVEL_DIFFERENCE + 1;
+
+		/// The level differences of the reports of a batch are stored interleaved (the differences of the i-th position of all reports are stored next to each other) which allows the validation of all reports of a batch using the same operations.
+		struct LevelReportBatch
+		{
+			std::size_t numReports;
+			std::size_t maxNumLevels;
+			std::array<std::uint32_t, NUM_REPORTS_PER_BATCH> numLevels;
+			// Difference between the levels at the positions i and i + 1
+			std::vector<ClampedLevelDifference> adjacentLevelDifferences;
+			// Difference between the levels at the positions i - 1 and i + 1 which is the difference resulting from the removal of the level at position i
+			std::vector<ClampedLevelDifference> skippingLevelDifferences;
+			// Lane masks whether all differences in front of respectively starting at the position are within the limits, a lane holds either no or all bits set with SSE2 and 0 or 1 otherwise
+			std::vector<std::uint8_t> areDifferencesInPrefixValid;
+			std::vector<std::uint8_t> areDifferencesInSuffixValid;
+		};
+
+		static constexpr std::size_t MIN_NUM_REPORTS_PER_THREAD = 1 << 12;
+
+		struct alignas(64) NumValidReportsOfThread
+		{
+			std::size_t numValidReports;
+		};
+
+		struct LevelReportBatchVerdicts
 		{
-			Equal = 0,
-			Negative = -1,
-			Positive = 1
+			LevelReportBatchVerdictMask validReports;
+			LevelReportBatchVerdictMask validReportsAllowingOneFaultyLevel;
+		};
+
+		static constexpr std::size_t STREAMING_INPUT_BLOCK_SIZE_IN_BYTES = 1 << 16;
+
+		/// Calls the level processor for every parsed level and the report finisher after the last level of every report.
+		/// @return Whether the buffer only contained well-formed reports
+		template <typename LevelProcessor, typename ReportFinisher>
+		[[nodiscard]] static bool processLevelReportsOfBuffer(std::string_view inputBuffer, LevelProcessor&& processLevel, ReportFinisher&& finishReport);
+
+		/// Validates the levels of a report one at a time in both directions, with one faulty level allowed the report stays valid if the removal of either an earlier level or the last processed level results in a valid report.
+		class StreamingLevelReportValidator
+		{
+		public:
+			StreamingLevelReportValidator() noexcept;
+
+			void processLevel(Level level) noexcept;
+			/// Adds the verdicts of the current report to the given counts and resets the validator for the next report.
+			void finishReport(NumbersOfValidReports& numbersOfValidReports) noexcept;
+
+		protected:
+			struct ValidationStateInDirection
+			{
+				bool isValid;
+				bool isValidAfterRemovalOfEarlierLevel;
+				bool isValidAfterRemovalOfLastLevel;
+			};
+
+			std::size_t numLevels;
+			Level previousLevel;
+			Level secondPreviousLevel;
+			ValidationStateInDirection ascendingLevelsState;
+			ValidationStateInDirection descendingLevelsState;
+
+			void processLevelInDirection(Level level, ClampedLevelDifference direction, ValidationStateInDirection& validationState) const noexcept;
 		};
 
-		[[nodiscard]] static std::optional<LevelReportCollection> parseInputData(const std::string& inputFileNamePath);
-		[[nodiscard]] static std::size_t determineNumberOfValidReports(const LevelReportCollection& userLevelReport, bool allowOneFaultyLevel);
-		[[nodiscard]] static LevelDifference determineSignOfLevelDifference(Level lLevel, Level rLevel) noexcept;
+		[[nodiscard]] static bool isReportValidAllowingFaultyLevelsInDirection(const LevelReport& levelReport, std::size_t maxNumFaultyLevels, ClampedLevelDifference direction, std::vector<std::size_t>& minNumRemovedLevelsKeepingLevel);
+		[[nodiscard]] static bool isLevelDifferenceWithinLimits(Level lLevel, Level rLevel, ClampedLevelDifference direction) noexcept;
+		template <typename LevelReports>
+		[[nodiscard]] static LevelReportVerdictBitmaps determineVerdictsOfReportsInParallel(const LevelReports& levelReports, std::size_t numThreads);
+		template <typename LevelReports>
+		[[nodiscard]] static std::size_t countValidReports(const LevelReports& levelReports, bool allowOneFaultyLevel, std::size_t numThreads);
+		/// Splits the reports into batch aligned chunks and calls the chunk processor with the index of the processing thread and the range of reports of the chunk.
+		/// @return The number of used threads
+		template <typename ReportChunkProcessor>
+		static std::size_t processReportChunksInParallel(std::size_t numReports, std::size_t numThreads, ReportChunkProcessor&& processReportChunk);
+		template <typename LevelReports>
+		[[nodiscard]] static std::size_t countValidReportsInRange(const LevelReports& levelReports, bool allowOneFaultyLevel, std::size_t firstReportIndex, std::size_t lastReportIndex);
 
-		[[nodiscard]] static bool isUserLevelReportValid(const LevelReport& levelReport) noexcept;
-		[[nodiscard]] static bool isUserLevelReportValidAllowingOneFaultyLevel(const LevelReport& levelReport) noexcept;
-		[[nodiscard]] static bool isLevelDifferenceBelowLimit(LevelDifference levelDifference, Level lLevel, Level rLevel) noexcept;
-		
+		template <typename LevelReports>
+		static void loadLevelReportBatch(const LevelReports& levelReports, std::size_t firstReportIndex, std::size_t lastReportIndex, LevelReportBatch& levelReportBatch);
+		[[nodiscard]] static LevelReportBatchVerdicts validateLevelReportBatch(LevelReportBatch& levelReportBatch) noexcept;
+		[[nodiscard]] static LevelReportBatchVerdicts validateLevelReportBatchInDirection(LevelReportBatch& levelReportBatch, ClampedLevelDifference direction) noexcept;
+		[[nodiscard]] static ClampedLevelDifference determineClampedLevelDifference(Level lLevel, Level rLevel) noexcept;
+		[[nodiscard]] static ClampedLevelDifference determineClampedLevelDifference(LevelDifference levelDifference) noexcept;
 	};
 }
 
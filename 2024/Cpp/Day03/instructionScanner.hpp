@@ -0,0 +1,461 @@
+#ifndef DAY03_INSTRUCTION_SCANNER_HPP
+#define DAY03_INSTRUCTION_SCANNER_HPP
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define DAY03_SSE2_PREFILTER_AVAILABLE
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Day03 {
+	using InstructionOperand = std::uint16_t;
+
+	enum class InstructionSemantics : std::uint8_t {
+		AddProductOfOperands,
+		AddSumOfOperands,
+		EnableEvaluation,
+		DisableEvaluation
+	};
+
+	/// An instruction descriptor defines the name, the number of operands and the semantics of an instruction of the form name(operand,...,operand) with every operand consisting of one
+	/// to three digits.
+	struct MulInstruction
+	{
+		static constexpr std::string_view NAME = "mul";
+		static constexpr std::size_t ARITY = 2;
+		static constexpr InstructionSemantics SEMANTICS = InstructionSemantics::AddProductOfOperands;
+	};
+
+	struct DoInstruction
+	{
+		static constexpr std::string_view NAME = "do";
+		static constexpr std::size_t ARITY = 0;
+		static constexpr InstructionSemantics SEMANTICS = InstructionSemantics::EnableEvaluation;
+	};
+
+	struct DontInstruction
+	{
+		static constexpr std::string_view NAME = "don't";
+		static constexpr std::size_t ARITY = 0;
+		static constexpr InstructionSemantics SEMANTICS = InstructionSemantics::DisableEvaluation;
+	};
+
+	/// Generates the transition table of the DFA recognizing the instructions of the given descriptors. The states of the DFA are the nodes of the trie of the instruction names
+	/// (with the start state being its root) followed by the states of the operands of every instruction. A character not continuing the name matched so far transitions to the
+	/// longest suffix of the matched characters that is a prefix of a name, i.e. to the earliest start of an instruction that is still possible.
+	template <typename... InstructionDescriptors>
+	class InstructionGrammar {
+	protected:
+		enum class Action : std::uint8_t {
+			None,
+			// The argument is zero if the current character starts a name, otherwise it is the number of characters by which the start of the name matched so far moves
+			MoveStartOfName,
+			OpenOperands,
+			AppendDigitToOperand,
+			EmitAddProductOfOperands,
+			EmitAddSumOfOperands,
+			EmitEnableEvaluation,
+			EmitDisableEvaluation
+		};
+
+		/// The next state is stored in the lowest bits of a transition followed by the action and its argument (the index of the instruction or operand).
+		using Transition = std::uint16_t;
+		static constexpr std::size_t NUM_STATE_BITS_OF_TRANSITION = 8;
+		static constexpr std::size_t NUM_ACTION_BITS_OF_TRANSITION = 3;
+		static constexpr std::size_t NUM_ARGUMENT_BITS_OF_TRANSITION = 8 * sizeof(Transition) - NUM_STATE_BITS_OF_TRANSITION - NUM_ACTION_BITS_OF_TRANSITION;
+		static constexpr std::size_t START_STATE = 0;
+		static constexpr std::size_t NO_STATE = static_cast<std::size_t>(-1);
+		static constexpr std::size_t MAX_NUM_DIGITS_PER_OPERAND = 3;
+
+		static constexpr std::size_t NUM_INSTRUCTIONS = sizeof...(InstructionDescriptors);
+		static constexpr std::size_t MAX_ARITY = std::max({ std::size_t(0), InstructionDescriptors::ARITY... });
+		static constexpr std::size_t MAX_NAME_LENGTH = std::max({ std::size_t(0), InstructionDescriptors::NAME.size()... });
+		static constexpr std::array<std::string_view, NUM_INSTRUCTIONS> NAMES = { InstructionDescriptors::NAME... };
+		static constexpr std::array<std::size_t, NUM_INSTRUCTIONS> ARITIES = { InstructionDescriptors::ARITY... };
+		static constexpr std::array<InstructionSemantics, NUM_INSTRUCTIONS> SEMANTICS = { InstructionDescriptors::SEMANTICS... };
+
+		[[nodiscard]] static constexpr Transition makeTransition(std::size_t nextState, Action action, std::size_t argument) noexcept
+		{
+			return static_cast<Transition>(nextState | (static_cast<std::size_t>(action) << NUM_STATE_BITS_OF_TRANSITION) | (argument << (NUM_STATE_BITS_OF_TRANSITION + NUM_ACTION_BITS_OF_TRANSITION)));
+		}
+
+		[[nodiscard]] static constexpr bool isOperandSyntaxCharacter(char character) noexcept
+		{
+			return (character >= '0' && character <= '9') || character == '(' || character == ',' || character == ')';
+		}
+
+		[[nodiscard]] static constexpr bool areNamesValid() noexcept
+		{
+			for (const std::string_view name : NAMES)
+			{
+				if (name.empty())
+					return false;
+				for (const char character : name)
+				{
+					if (isOperandSyntaxCharacter(character))
+						return false;
+				}
+			}
+			return true;
+		}
+
+		/// The operands of an instruction whose name is a suffix of another one would compete with the operands of the latter for the same characters.
+		[[nodiscard]] static constexpr bool isAnyNameSuffixOfOtherName() noexcept
+		{
+			for (std::size_t instructionIndex = 0; instructionIndex < NUM_INSTRUCTIONS; ++instructionIndex)
+			{
+				for (std::size_t otherInstructionIndex = 0; otherInstructionIndex < NUM_INSTRUCTIONS; ++otherInstructionIndex)
+				{
+					const std::string_view name = NAMES[instructionIndex];
+					const std::string_view otherName = NAMES[otherInstructionIndex];
+					if (instructionIndex != otherInstructionIndex && name.size() <= otherName.size() && otherName.substr(otherName.size() - name.size()) == name)
+						return true;
+				}
+			}
+			return false;
+		}
+
+		/// Every name prefix is represented by its first occurrence in the names, the states of the name prefixes are numbered in the order of their first occurrence.
+		[[nodiscard]] static constexpr bool isFirstOccurrenceOfNamePrefix(std::size_t instructionIndex, std::size_t prefixLength) noexcept
+		{
+			const std::string_view namePrefix = NAMES[instructionIndex].substr(0, prefixLength);
+			for (std::size_t otherInstructionIndex = 0; otherInstructionIndex < instructionIndex; ++otherInstructionIndex)
+			{
+				if (NAMES[otherInstructionIndex].substr(0, prefixLength) == namePrefix)
+					return false;
+			}
+			return true;
+		}
+
+		template <typename NamePrefixVisitor>
+		static constexpr void forEachNamePrefixState(NamePrefixVisitor&& namePrefixVisitor) noexcept
+		{
+			std::size_t state = START_STATE + 1;
+			for (std::size_t instructionIndex = 0; instructionIndex < NUM_INSTRUCTIONS; ++instructionIndex)
+			{
+				for (std::size_t prefixLength = 1; prefixLength <= NAMES[instructionIndex].size(); ++prefixLength)
+				{
+					if (isFirstOccurrenceOfNamePrefix(instructionIndex, prefixLength))
+						namePrefixVisitor(state++, NAMES[instructionIndex].substr(0, prefixLength));
+				}
+			}
+		}
+
+		[[nodiscard]] static constexpr std::size_t countNameStates() noexcept
+		{
+			std::size_t numNameStates = START_STATE + 1;
+			forEachNamePrefixState([&numNameStates](std::size_t, std::string_view) { ++numNameStates; });
+			return numNameStates;
+		}
+
+		/// The operand states of an instruction are the state expecting an operand followed by the states having matched one, two or three digits of the operand for every operand,
+		/// an instruction without operands only requires the state expecting the closing bracket.
+		[[nodiscard]] static constexpr std::size_t countOperandStatesOfInstruction(std::size_t instructionIndex) noexcept
+		{
+			return ARITIES[instructionIndex] ? ARITIES[instructionIndex] * (1 + MAX_NUM_DIGITS_PER_OPERAND) : 1;
+		}
+
+		[[nodiscard]] static constexpr std::size_t determineFirstOperandStateOfInstruction(std::size_t instructionIndex) noexcept
+		{
+			std::size_t firstOperandState = countNameStates();
+			for (std::size_t otherInstructionIndex = 0; otherInstructionIndex < instructionIndex; ++otherInstructionIndex)
+				firstOperandState += countOperandStatesOfInstruction(otherInstructionIndex);
+			return firstOperandState;
+		}
+
+		[[nodiscard]] static constexpr std::size_t countStates() noexcept
+		{
+			return determineFirstOperandStateOfInstruction(NUM_INSTRUCTIONS);
+		}
+
+		[[nodiscard]] static constexpr std::size_t findNameState(std::string_view namePrefix, char nextCharacter) noexcept
+		{
+			std::size_t foundState = NO_STATE;
+			forEachNamePrefixState([&](std::size_t state, std::string_view otherNamePrefix)
+			{
+				if (otherNamePrefix.size() == namePrefix.size() + 1 && otherNamePrefix.back() == nextCharacter && otherNamePrefix.substr(0, namePrefix.size()) == namePrefix)
+					foundState = state;
+			});
+			return foundState;
+		}
+
+		[[nodiscard]] static constexpr Transition determineNameStateTransition(std::string_view namePrefix, char character) noexcept
+		{
+			for (std::size_t suffixOffset = 0; suffixOffset <= namePrefix.size(); ++suffixOffset)
+			{
+				const std::string_view suffixOfNamePrefix = namePrefix.substr(suffixOffset);
+				if (character == '(')
+				{
+					for (std::size_t instructionIndex = 0; instructionIndex < NUM_INSTRUCTIONS; ++instructionIndex)
+					{
+						if (NAMES[instructionIndex] == suffixOfNamePrefix)
+							return makeTransition(determineFirstOperandStateOfInstruction(instructionIndex), Action::OpenOperands, instructionIndex);
+					}
+				}
+				else if (const std::size_t nextState = findNameState(suffixOfNamePrefix, character); nextState != NO_STATE)
+				{
+					if (namePrefix.empty())
+						return makeTransition(nextState, Action::MoveStartOfName, 0);
+					return suffixOffset ? makeTransition(nextState, Action::MoveStartOfName, suffixOffset) : makeTransition(nextState, Action::None, 0);
+				}
+			}
+			return makeTransition(START_STATE, Action::None, 0);
+		}
+
+		template <std::size_t NumStates>
+		[[nodiscard]] static constexpr std::array<std::array<Transition, 256>, NumStates> buildTransitionTable() noexcept
+		{
+			std::array<std::array<Transition, 256>, NumStates> transitionTable{};
+
+			// Only the characters of the names and the opening bracket can lead to other transitions than the ones of the start state
+			auto setTransitionsOfNameState = [&transitionTable](std::size_t state, std::string_view namePrefix)
+			{
+				for (const std::string_view name : NAMES)
+				{
+					for (const char character : name)
+						transitionTable[state][static_cast<unsigned char>(character)] = determineNameStateTransition(namePrefix, character);
+				}
+				transitionTable[state][static_cast<unsigned char>('(')] = determineNameStateTransition(namePrefix, '(');
+			};
+			setTransitionsOfNameState(START_STATE, std::string_view());
+			for (std::size_t state = START_STATE + 1; state < NumStates; ++state)
+				transitionTable[state] = transitionTable[START_STATE];
+			forEachNamePrefixState(setTransitionsOfNameState);
+
+			for (std::size_t instructionIndex = 0; instructionIndex < NUM_INSTRUCTIONS; ++instructionIndex)
+			{
+				const std::size_t firstOperandState = determineFirstOperandStateOfInstruction(instructionIndex);
+				const Transition emittingTransition = makeTransition(START_STATE, static_cast<Action>(static_cast<std::size_t>(Action::EmitAddProductOfOperands) + static_cast<std::size_t>(SEMANTICS[instructionIndex])), 0);
+				if (!ARITIES[instructionIndex])
+				{
+					transitionTable[firstOperandState][static_cast<unsigned char>(')')] = emittingTransition;
+					continue;
+				}
+
+				for (std::size_t operandIndex = 0; operandIndex < ARITIES[instructionIndex]; ++operandIndex)
+				{
+					const std::size_t operandState = firstOperandState + operandIndex * (1 + MAX_NUM_DIGITS_PER_OPERAND);
+					for (std::size_t numDigits = 0; numDigits <= MAX_NUM_DIGITS_PER_OPERAND; ++numDigits)
+					{
+						if (numDigits < MAX_NUM_DIGITS_PER_OPERAND)
+						{
+							for (char digit = '0'; digit <= '9'; ++digit)
+								transitionTable[operandState + numDigits][static_cast<unsigned char>(digit)] = makeTransition(operandState + numDigits + 1, Action::AppendDigitToOperand, operandIndex);
+						}
+						if (!numDigits)
+							continue;
+
+						if (operandIndex + 1 < ARITIES[instructionIndex])
+							transitionTable[operandState + numDigits][static_cast<unsigned char>(',')] = makeTransition(operandState + 1 + MAX_NUM_DIGITS_PER_OPERAND, Action::None, 0);
+						else
+							transitionTable[operandState + numDigits][static_cast<unsigned char>(')')] = emittingTransition;
+					}
+				}
+			}
+			return transitionTable;
+		}
+
+		template <std::size_t NumNameStates>
+		[[nodiscard]] static constexpr std::array<std::size_t, NumNameStates> determineNamePrefixLengths() noexcept
+		{
+			std::array<std::size_t, NumNameStates> namePrefixLengths{};
+			forEachNamePrefixState([&namePrefixLengths](std::size_t state, std::string_view namePrefix) { namePrefixLengths[state] = namePrefix.size(); });
+			return namePrefixLengths;
+		}
+
+		[[nodiscard]] static constexpr std::size_t countStartCharacters() noexcept
+		{
+			std::size_t numStartCharacters = 0;
+			for (std::size_t instructionIndex = 0; instructionIndex < NUM_INSTRUCTIONS; ++instructionIndex)
+				numStartCharacters += isFirstOccurrenceOfNamePrefix(instructionIndex, 1);
+			return numStartCharacters;
+		}
+
+		template <std::size_t NumStartCharacters>
+		[[nodiscard]] static constexpr std::array<char, NumStartCharacters> determineStartCharacters() noexcept
+		{
+			std::array<char, NumStartCharacters> startCharacters{};
+			std::size_t numStartCharacters = 0;
+			for (std::size_t instructionIndex = 0; instructionIndex < NUM_INSTRUCTIONS; ++instructionIndex)
+			{
+				if (isFirstOccurrenceOfNamePrefix(instructionIndex, 1))
+					startCharacters[numStartCharacters++] = NAMES[instructionIndex].front();
+			}
+			return startCharacters;
+		}
+
+		/// The operands not used by an instruction are set to the neutral element of its semantics, thus the evaluation of an instruction can always process all operands.
+		[[nodiscard]] static constexpr std::array<std::array<InstructionOperand, MAX_ARITY>, NUM_INSTRUCTIONS> determineInitialOperands() noexcept
+		{
+			std::array<std::array<InstructionOperand, MAX_ARITY>, NUM_INSTRUCTIONS> initialOperands{};
+			for (std::size_t instructionIndex = 0; instructionIndex < NUM_INSTRUCTIONS; ++instructionIndex)
+			{
+				for (std::size_t operandIndex = ARITIES[instructionIndex]; operandIndex < MAX_ARITY; ++operandIndex)
+					initialOperands[instructionIndex][operandIndex] = static_cast<InstructionOperand>(SEMANTICS[instructionIndex] == InstructionSemantics::AddProductOfOperands);
+			}
+			return initialOperands;
+		}
+	};
+
+	/// Scans a buffer for the instructions of the given descriptors using a transition table generated at compile time, the recognized instructions are passed to an instruction sink
+	/// together with their semantics as a compile-time constant.
+	template <typename... InstructionDescriptors>
+	class InstructionScanner : protected InstructionGrammar<InstructionDescriptors...> {
+	protected:
+		using Grammar = InstructionGrammar<InstructionDescriptors...>;
+		using typename Grammar::Action;
+		using typename Grammar::Transition;
+		using Grammar::NUM_STATE_BITS_OF_TRANSITION;
+		using Grammar::NUM_ACTION_BITS_OF_TRANSITION;
+		using Grammar::NUM_ARGUMENT_BITS_OF_TRANSITION;
+		using Grammar::START_STATE;
+		using Grammar::NAMES;
+
+		static constexpr std::size_t NUM_NAME_STATES = Grammar::countNameStates();
+		static constexpr std::size_t NUM_STATES = Grammar::countStates();
+		static constexpr std::size_t NUM_START_CHARACTERS = Grammar::countStartCharacters();
+
+		static_assert(Grammar::NUM_INSTRUCTIONS > 0, "At least one instruction needs to be defined");
+		static_assert(Grammar::areNamesValid(), "The names of the instructions need to be non-empty and must not contain digits, brackets or commas");
+		static_assert(!Grammar::isAnyNameSuffixOfOtherName(), "The name of an instruction must not be a suffix of the name of another instruction");
+		static_assert(NUM_STATES <= (1 << NUM_STATE_BITS_OF_TRANSITION), "The states of the instructions need to fit into the state bits of a transition");
+		static_assert(Grammar::NUM_INSTRUCTIONS <= (1 << NUM_ARGUMENT_BITS_OF_TRANSITION) && Grammar::MAX_ARITY <= (1 << NUM_ARGUMENT_BITS_OF_TRANSITION), "The indices of the instructions and operands need to fit into the argument bits of a transition");
+		static_assert(Grammar::MAX_NAME_LENGTH <= (1 << NUM_ARGUMENT_BITS_OF_TRANSITION), "The lengths of the names need to fit into the argument bits of a transition");
+
+		static constexpr std::array<std::array<Transition, 256>, NUM_STATES> TRANSITION_TABLE = Grammar::template buildTransitionTable<NUM_STATES>();
+		static constexpr std::array<std::size_t, NUM_NAME_STATES> NAME_PREFIX_LENGTHS = Grammar::template determineNamePrefixLengths<NUM_NAME_STATES>();
+		static constexpr std::array<char, NUM_START_CHARACTERS> START_CHARACTERS = Grammar::template determineStartCharacters<NUM_START_CHARACTERS>();
+
+	public:
+		using Operands = std::array<InstructionOperand, Grammar::MAX_ARITY>;
+
+		/// Everything required to resume the scan of an instruction whose characters are split across consecutive buffers. Byte offsets are relative to the start of the first buffer scanned
+		/// using the context, thus the offset of an instruction straddling two buffers refers to the buffer in which it started.
+		struct Context
+		{
+			std::size_t state;
+			std::size_t instructionIndex;
+			Operands operands;
+			std::size_t byteOffsetOfInstruction;
+			std::size_t byteOffsetOfBuffer;
+		};
+
+		[[nodiscard]] static constexpr Context makeInitialContext() noexcept
+		{
+			return Context{ START_STATE, 0, Operands{}, 0, 0 };
+		}
+
+		/// Passes all instructions starting in the range [firstByteOffset, lastByteOffset) to the instruction sink. An instruction straddling the end of the range is owned by this range
+		/// and completed using the characters following it, if the buffer ends before the instruction is complete the scan can be resumed with the next buffer using the same context.
+		template <typename InstructionSink>
+		static void scanInstructions(std::string_view inputBuffer, std::size_t firstByteOffset, std::size_t lastByteOffset, Context& context, InstructionSink&& instructionSink)
+		{
+			const std::string_view bufferUpToLastByteOffset = inputBuffer.substr(0, lastByteOffset);
+			std::size_t state = context.state;
+			for (std::size_t currentByteOffset = firstByteOffset;; ++currentByteOffset)
+			{
+				if (state == START_STATE)
+				{
+					if (currentByteOffset >= lastByteOffset || (currentByteOffset = findNextInstructionCandidate(bufferUpToLastByteOffset, currentByteOffset)) == lastByteOffset)
+						break;
+				}
+				// The characters following the range are only of interest until the straddling instruction is completed or rejected, a later instruction is owned by the following range
+				else if (currentByteOffset >= lastByteOffset && (currentByteOffset == inputBuffer.size() || context.byteOffsetOfInstruction >= context.byteOffsetOfBuffer + lastByteOffset))
+					break;
+
+				const auto character = static_cast<unsigned char>(inputBuffer[currentByteOffset]);
+				const Transition transition = TRANSITION_TABLE[state][character];
+				const std::size_t argument = transition >> (NUM_STATE_BITS_OF_TRANSITION + NUM_ACTION_BITS_OF_TRANSITION);
+				const std::size_t previousState = state;
+				state = transition & ((1 << NUM_STATE_BITS_OF_TRANSITION) - 1);
+				switch (static_cast<Action>((transition >> NUM_STATE_BITS_OF_TRANSITION) & ((1 << NUM_ACTION_BITS_OF_TRANSITION) - 1)))
+				{
+				case Action::None:
+					break;
+				case Action::MoveStartOfName:
+					context.byteOffsetOfInstruction = argument ? context.byteOffsetOfInstruction + argument : context.byteOffsetOfBuffer + currentByteOffset;
+					break;
+				// The opened instruction is the longest name that is a suffix of the matched name prefix, the characters in front of it do not belong to the instruction
+				case Action::OpenOperands:
+					context.instructionIndex = argument;
+					context.operands = INITIAL_OPERANDS[argument];
+					context.byteOffsetOfInstruction += NAME_PREFIX_LENGTHS[previousState] - NAMES[argument].size();
+					break;
+				case Action::AppendDigitToOperand:
+					context.operands[argument] = static_cast<InstructionOperand>(context.operands[argument] * 10 + (character - '0'));
+					break;
+				case Action::EmitAddProductOfOperands:
+					instructionSink(std::integral_constant<InstructionSemantics, InstructionSemantics::AddProductOfOperands>(), std::as_const(context));
+					break;
+				case Action::EmitAddSumOfOperands:
+					instructionSink(std::integral_constant<InstructionSemantics, InstructionSemantics::AddSumOfOperands>(), std::as_const(context));
+					break;
+				case Action::EmitEnableEvaluation:
+					instructionSink(std::integral_constant<InstructionSemantics, InstructionSemantics::EnableEvaluation>(), std::as_const(context));
+					break;
+				case Action::EmitDisableEvaluation:
+					instructionSink(std::integral_constant<InstructionSemantics, InstructionSemantics::DisableEvaluation>(), std::as_const(context));
+					break;
+				}
+			}
+			context.state = state;
+			context.byteOffsetOfBuffer += inputBuffer.size();
+		}
+
+		/// Skips all characters that cannot start an instruction, i.e. everything but the first characters of the names.
+		/// @return The offset of the next candidate or the size of the buffer if no candidate remains
+		[[nodiscard]] static std::size_t findNextInstructionCandidate(std::string_view inputBuffer, std::size_t currentByteOffset) noexcept
+		{
+#ifdef DAY03_SSE2_PREFILTER_AVAILABLE
+			// Two 16 byte blocks are compared per iteration since the candidates are rare in the corrupted memory
+			for (; currentByteOffset + 2 * sizeof(__m128i) <= inputBuffer.size(); currentByteOffset += 2 * sizeof(__m128i))
+			{
+				const __m128i lBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(inputBuffer.data() + currentByteOffset));
+				const __m128i rBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(inputBuffer.data() + currentByteOffset + sizeof(__m128i)));
+				__m128i lCandidates = _mm_setzero_si128();
+				__m128i rCandidates = _mm_setzero_si128();
+				for (const char startCharacter : START_CHARACTERS)
+				{
+					const __m128i repeatedStartCharacter = _mm_set1_epi8(startCharacter);
+					lCandidates = _mm_or_si128(lCandidates, _mm_cmpeq_epi8(lBlock, repeatedStartCharacter));
+					rCandidates = _mm_or_si128(rCandidates, _mm_cmpeq_epi8(rBlock, repeatedStartCharacter));
+				}
+
+				const std::uint32_t candidateMask = static_cast<std::uint32_t>(_mm_movemask_epi8(lCandidates)) | (static_cast<std::uint32_t>(_mm_movemask_epi8(rCandidates)) << sizeof(__m128i));
+				if (!candidateMask)
+					continue;
+
+#if defined(_MSC_VER)
+				unsigned long indexOfFirstCandidate;
+				_BitScanForward(&indexOfFirstCandidate, candidateMask);
+				return currentByteOffset + indexOfFirstCandidate;
+#else
+				return currentByteOffset + static_cast<std::size_t>(__builtin_ctz(candidateMask));
+#endif
+			}
+#endif
+
+			for (; currentByteOffset < inputBuffer.size(); ++currentByteOffset)
+			{
+				if (std::find(START_CHARACTERS.cbegin(), START_CHARACTERS.cend(), inputBuffer[currentByteOffset]) != START_CHARACTERS.cend())
+					return currentByteOffset;
+			}
+			return inputBuffer.size();
+		}
+
+	protected:
+		static constexpr std::array<Operands, Grammar::NUM_INSTRUCTIONS> INITIAL_OPERANDS = Grammar::determineInitialOperands();
+	};
+}
+
+#endif
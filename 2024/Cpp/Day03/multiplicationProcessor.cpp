@@ -1,146 +1,106 @@
 #include "multiplicationProcessor.hpp"
+#include "streamingMultiplicationProcessor.hpp"
 
+#include <algorithm>
+#include <array>
 #include <fstream>
-#include <sstream>
+#include <thread>
 
 using namespace Day03;
 
 long MultiplicationProcessor::processMultiplicationsFromFile(const std::string& inputFilename, bool conditionalMultiplicationEvaluationEnabled)
 {
 	std::ifstream inputFileStream(inputFilename, std::ios_base::binary);
-	return inputFileStream.is_open() ? processMultiplicationsFromStream(inputFileStream, conditionalMultiplicationEvaluationEnabled) : 0;
+	if (!inputFileStream.is_open())
+		return 0;
+
+	StreamingMultiplicationProcessor streamingMultiplicationProcessor(conditionalMultiplicationEvaluationEnabled);
+	std::array<char, INPUT_FILE_BLOCK_SIZE_IN_BYTES> inputFileBlock;
+	while (inputFileStream)
+	{
+		inputFileStream.read(inputFileBlock.data(), inputFileBlock.size());
+		streamingMultiplicationProcessor.feed(std::string_view(inputFileBlock.data(), static_cast<std::size_t>(inputFileStream.gcount())));
+	}
+	return streamingMultiplicationProcessor.currentSum();
 }
 
 long MultiplicationProcessor::processMultiplicationsFromString(const std::string& inputString, bool conditionalMultiplicationEvaluationEnabled)
 {
-	std::istringstream inputStringStream(inputString, std::ios_base::in);
-	return processMultiplicationsFromStream(inputStringStream, conditionalMultiplicationEvaluationEnabled);
+	return processMultiplicationsFromBuffer(inputString, conditionalMultiplicationEvaluationEnabled);
 }
 
-// START NON-PUBLIC FUNCTIONALITY
-long MultiplicationProcessor::processMultiplicationsFromStream(std::istream& inputStream, bool conditionalMultiplicationEvaluationEnabled)
+long MultiplicationProcessor::processMultiplicationsFromBuffer(std::string_view inputBuffer, bool conditionalMultiplicationEvaluationEnabled)
 {
-	std::optional<MultiplicationFactor> multiplicationLFactor;
-	std::optional<MultiplicationFactor> multiplicationRFactor;
-	auto lastProcessedKeywordKind = KeywordKind::None;
-
-	long determinedSum = 0;
-	bool multiplicationsEnabled = true;
-	while (inputStream.peek() != EOF)
-	{
-		multiplicationLFactor.reset();
-		multiplicationRFactor.reset();
-
-		const bool parsingOk = static_cast<char>(searchForKeywordPrefix(inputStream, lastProcessedKeywordKind, conditionalMultiplicationEvaluationEnabled)
-			&& (lastProcessedKeywordKind != KeywordKind::None ? checkIfNextCharacterInStreamIs(inputStream, '(') : true)
-			&& (lastProcessedKeywordKind == KeywordKind::Mul
-				? extractNumberFromStream(inputStream, multiplicationLFactor)
-					&& checkIfNextCharacterInStreamIs(inputStream, ',')
-					&& extractNumberFromStream(inputStream, multiplicationRFactor)
-				: true)
-			&& (lastProcessedKeywordKind != KeywordKind::None ? checkIfNextCharacterInStreamIs(inputStream, ')') : true));
-
-		multiplicationsEnabled = parsingOk
-			? !conditionalMultiplicationEvaluationEnabled || (lastProcessedKeywordKind == KeywordKind::Do || (multiplicationsEnabled && lastProcessedKeywordKind == KeywordKind::Mul))
-			: multiplicationsEnabled;
-
-		determinedSum += parsingOk && multiplicationsEnabled
-			? static_cast<long>(multiplicationLFactor.value_or(0)) * static_cast<long>(multiplicationRFactor.value_or(0))
-			: 0;
-	}
-	return determinedSum;
+	return summarizeChunk(inputBuffer, 0, inputBuffer.size(), conditionalMultiplicationEvaluationEnabled).sumIfStartedEnabled;
 }
-bool MultiplicationProcessor::searchForKeywordPrefix(std::istream& inputStream, KeywordKind& processedKeywordPrefix, bool conditionalMultiplicationEvaluationEnabled)
-{
-	char currInputStreamCharacter;
-	auto aggregateOfKeywordFlags = KeywordCharacterFlags::None;
-	processedKeywordPrefix = KeywordKind::None;
 
-	constexpr auto aggregateOfMulKeyword = KeywordCharacterFlags::M | KeywordCharacterFlags::U | KeywordCharacterFlags::L;
-	constexpr auto aggregateOfDoKeyword = KeywordCharacterFlags::D | KeywordCharacterFlags::O;
-	constexpr auto aggregateOfDontKeyword = aggregateOfDoKeyword | KeywordCharacterFlags::N | KeywordCharacterFlags::Apostrophe | KeywordCharacterFlags::T;
+long MultiplicationProcessor::processMultiplicationsFromBuffer(std::string_view inputBuffer, bool conditionalMultiplicationEvaluationEnabled, std::size_t numThreads)
+{
+	if (!numThreads)
+		numThreads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+	numThreads = std::max<std::size_t>(1, std::min(numThreads, inputBuffer.size() / MIN_NUM_BYTES_PER_THREAD));
 
-	bool prematureExitPossible = false;
-	while ((currInputStreamCharacter = static_cast<char>(inputStream.peek())) != EOF &&
-		!((aggregateOfKeywordFlags == aggregateOfMulKeyword) || prematureExitPossible || (conditionalMultiplicationEvaluationEnabled && aggregateOfKeywordFlags == aggregateOfDontKeyword)))
+	const std::size_t numBytesPerThread = inputBuffer.size() / numThreads;
+	std::vector<ChunkSummary> chunkSummaries(numThreads);
+	auto summarizeChunkOfThread = [&](std::size_t threadIndex)
 	{
-		bool performedPrematureInputStreamRead = false;
-		switch (currInputStreamCharacter)
-		{
-		case 'm':
-			setFlagInAggregateWhenEqualToOtherwiseReset(aggregateOfKeywordFlags, KeywordCharacterFlags::None, KeywordCharacterFlags::M);
-			break;
-		case 'u':
-			setFlagInAggregateWhenEqualToOtherwiseReset(aggregateOfKeywordFlags, KeywordCharacterFlags::M, KeywordCharacterFlags::U);
-			break;
-		case 'l':
-			setFlagInAggregateWhenEqualToOtherwiseReset(aggregateOfKeywordFlags, aggregateOfMulKeyword ^ KeywordCharacterFlags::L, KeywordCharacterFlags::L);
-			break;
-		case 'd':
-			setFlagInAggregateWhenEqualToOtherwiseReset(aggregateOfKeywordFlags, KeywordCharacterFlags::None, KeywordCharacterFlags::D);
-			break;
-		case 'o':
-		{
-			setFlagInAggregateWhenEqualToOtherwiseReset(aggregateOfKeywordFlags, KeywordCharacterFlags::D, KeywordCharacterFlags::O);
-			performedPrematureInputStreamRead = conditionalMultiplicationEvaluationEnabled;
-			inputStream.read(&currInputStreamCharacter, performedPrematureInputStreamRead);
-			prematureExitPossible = conditionalMultiplicationEvaluationEnabled ? aggregateOfKeywordFlags == aggregateOfDoKeyword && static_cast<char>(inputStream.peek()) != 'n' : false;
-			break;
-		}
-		case 'n':
-			setFlagInAggregateWhenEqualToOtherwiseReset(aggregateOfKeywordFlags, aggregateOfDoKeyword, KeywordCharacterFlags::N);
-			break;
-		case '\'':
-			setFlagInAggregateWhenEqualToOtherwiseReset(aggregateOfKeywordFlags, aggregateOfDoKeyword | KeywordCharacterFlags::N, KeywordCharacterFlags::Apostrophe);
-			break;
-		case 't':
-			setFlagInAggregateWhenEqualToOtherwiseReset(aggregateOfKeywordFlags, aggregateOfDontKeyword ^ KeywordCharacterFlags::T, KeywordCharacterFlags::T);
-			break;
-		default:
-			aggregateOfKeywordFlags = KeywordCharacterFlags::None;
-			break;
-		}
-		inputStream.read(&currInputStreamCharacter, !performedPrematureInputStreamRead);
-	}
+		const std::size_t firstByteOffset = threadIndex * numBytesPerThread;
+		const std::size_t lastByteOffset = threadIndex + 1 == numThreads ? inputBuffer.size() : firstByteOffset + numBytesPerThread;
+		chunkSummaries[threadIndex] = summarizeChunk(inputBuffer, firstByteOffset, lastByteOffset, conditionalMultiplicationEvaluationEnabled);
+	};
 
-	switch (aggregateOfKeywordFlags)
-	{
-	case aggregateOfMulKeyword:
-		processedKeywordPrefix = KeywordKind::Mul;
-		break;
-	case aggregateOfDoKeyword:
-		processedKeywordPrefix = KeywordKind::Do;
-		break;
-	case aggregateOfDontKeyword:
-		processedKeywordPrefix = KeywordKind::Dont;
-		break;
-	}
-	return processedKeywordPrefix != KeywordKind::None;
+	std::vector<std::thread> workerThreads;
+	workerThreads.reserve(numThreads - 1);
+	for (std::size_t threadIndex = 1; threadIndex < numThreads; ++threadIndex)
+		workerThreads.emplace_back(summarizeChunkOfThread, threadIndex);
+
+	summarizeChunkOfThread(0);
+	for (std::thread& workerThread : workerThreads)
+		workerThread.join();
+
+	// The final state of a chunk determines which of the sums of the following chunk applies
+	long determinedSum = 0;
+	bool multiplicationsEnabled = true;
+	for (const ChunkSummary& chunkSummary : chunkSummaries)
+		applyChunkSummary(chunkSummary, determinedSum, multiplicationsEnabled);
+	return determinedSum;
 }
 
-bool MultiplicationProcessor::extractNumberFromStream(std::istream& inputStream, std::optional<MultiplicationFactor>& extractedNumberContainer)
+MultiplicationProcessor::ExtractedInstructions MultiplicationProcessor::extractInstructionsFromBuffer(std::string_view inputBuffer)
 {
-	MultiplicationFactor numericValueOfStringifedNumber = 0;
-	char numDigitsOfProcessedNumber = 0;
-
-	char currInputStreamCharacter = static_cast<char>(inputStream.peek());
-	for (std::size_t i = 0; i < 3 && currInputStreamCharacter != EOF && std::isdigit(currInputStreamCharacter); ++i)
+	using ScannerContext = ConditionalMultiplicationScanner::Context;
+	std::size_t numInstructions = 0;
+	ScannerContext scannerContext = ConditionalMultiplicationScanner::makeInitialContext();
+	ConditionalMultiplicationScanner::scanInstructions(inputBuffer, 0, inputBuffer.size(), scannerContext, [&numInstructions](auto, const ScannerContext&) { ++numInstructions; });
+
+	ExtractedInstructions extractedInstructions;
+	extractedInstructions.byteOffsets.reserve(numInstructions);
+	extractedInstructions.multiplicationLFactors.reserve(numInstructions);
+	extractedInstructions.multiplicationRFactors.reserve(numInstructions);
+	extractedInstructions.keywordKinds.reserve(numInstructions);
+
+	scannerContext = ConditionalMultiplicationScanner::makeInitialContext();
+	ConditionalMultiplicationScanner::scanInstructions(inputBuffer, 0, inputBuffer.size(), scannerContext, [&extractedInstructions](auto, const ScannerContext& context)
 	{
-		inputStream.get();
-		numericValueOfStringifedNumber *= !numDigitsOfProcessedNumber++ ? 1 : 10;
-		numericValueOfStringifedNumber += static_cast<char>(currInputStreamCharacter - '0');
-		currInputStreamCharacter = static_cast<char>(inputStream.peek());
-	}
-
-	extractedNumberContainer = numericValueOfStringifedNumber;
-	return numDigitsOfProcessedNumber;
+		extractedInstructions.byteOffsets.push_back(context.byteOffsetOfInstruction);
+		extractedInstructions.multiplicationLFactors.push_back(context.operands[0]);
+		extractedInstructions.multiplicationRFactors.push_back(context.operands[1]);
+		extractedInstructions.keywordKinds.push_back(KEYWORD_KINDS_OF_CONDITIONAL_MULTIPLICATION_INSTRUCTIONS[context.instructionIndex]);
+	});
+	return extractedInstructions;
 }
 
-inline bool MultiplicationProcessor::checkIfNextCharacterInStreamIs(std::istream& inputStream, char expectedCharacter)
+// START NON-PUBLIC FUNCTIONALITY
+MultiplicationProcessor::ChunkSummary MultiplicationProcessor::summarizeChunk(std::string_view inputBuffer, std::size_t firstByteOffset, std::size_t lastByteOffset, bool conditionalMultiplicationEvaluationEnabled) noexcept
 {
-	if (static_cast<char>(inputStream.peek()) != expectedCharacter)
-		return false;
+	// Without the conditional evaluation the do() and don't() keywords are of no interest and thus not even recognized by the scanner
+	return conditionalMultiplicationEvaluationEnabled
+		? summarizeChunkUsingScanner<ConditionalMultiplicationScanner>(inputBuffer, firstByteOffset, lastByteOffset)
+		: summarizeChunkUsingScanner<MultiplicationScanner>(inputBuffer, firstByteOffset, lastByteOffset);
+}
 
-	inputStream.get();
-	return true;
+void MultiplicationProcessor::applyChunkSummary(const ChunkSummary& chunkSummary, long& determinedSum, bool& multiplicationsEnabled) noexcept
+{
+	determinedSum += multiplicationsEnabled ? chunkSummary.sumIfStartedEnabled : chunkSummary.sumIfStartedDisabled;
+	multiplicationsEnabled = multiplicationsEnabled ? chunkSummary.enabledAtEndIfStartedEnabled : chunkSummary.enabledAtEndIfStartedDisabled;
 }
@@ -1,26 +1,17 @@
 #ifndef DAY03_MULTIPLICATION_PROCESSOR_HPP
 #define DAY03_MULTIPLICATION_PROCESSOR_HPP
-#include <istream>
-#include <optional>
+#include "instructionScanner.hpp"
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace Day03 {
 	class MultiplicationProcessor {
 	public:
-		[[nodiscard]] static long processMultiplicationsFromFile(const std::string& inputFilename, bool conditionalMultiplicationEvaluationEnabled);
-		[[nodiscard]] static long processMultiplicationsFromString(const std::string& inputString, bool conditionalMultiplicationEvaluationEnabled);
-	protected:
-		using MultiplicationFactor = uint16_t;
-		enum class KeywordCharacterFlags : uint8_t {
-			None = 0,
-			M = 1,
-			U = 2,
-			L = 4,
-			D = 8,
-			O = 16,
-			N = 32,
-			Apostrophe = 64,
-			T = 128,
-		};
+		using MultiplicationFactor = InstructionOperand;
 		enum class KeywordKind : char {
 			Mul = -1,
 			Do = 1,
@@ -28,45 +19,96 @@ namespace Day03 {
 			None = 2
 		};
 
-		constexpr friend KeywordCharacterFlags operator|(KeywordCharacterFlags lFlag, KeywordCharacterFlags rFlag)
+		/// The recognized instructions of a buffer stored as parallel arrays, the instruction itself can be looked up in the buffer at its byte offset. The factors of the do() and don't()
+		/// keywords are zero.
+		struct ExtractedInstructions
 		{
-			return static_cast<KeywordCharacterFlags>(static_cast<uint8_t>(lFlag) | static_cast<uint8_t>(rFlag));
-		}
+			std::vector<std::size_t> byteOffsets;
+			std::vector<MultiplicationFactor> multiplicationLFactors;
+			std::vector<MultiplicationFactor> multiplicationRFactors;
+			std::vector<KeywordKind> keywordKinds;
 
-		constexpr friend KeywordCharacterFlags operator&(KeywordCharacterFlags lFlag, KeywordCharacterFlags rFlag)
-		{
-			return static_cast<KeywordCharacterFlags>(static_cast<uint8_t>(lFlag) & static_cast<uint8_t>(rFlag));
-		}
+			[[nodiscard]] std::size_t size() const noexcept { return byteOffsets.size(); }
+		};
 
-		constexpr friend KeywordCharacterFlags operator^(KeywordCharacterFlags lFlag, KeywordCharacterFlags rFlag)
-		{
-			return static_cast<KeywordCharacterFlags>(static_cast<uint8_t>(lFlag) ^ static_cast<uint8_t>(rFlag));
-		}
+		[[nodiscard]] static long processMultiplicationsFromFile(const std::string& inputFilename, bool conditionalMultiplicationEvaluationEnabled);
+		[[nodiscard]] static long processMultiplicationsFromString(const std::string& inputString, bool conditionalMultiplicationEvaluationEnabled);
+		[[nodiscard]] static long processMultiplicationsFromBuffer(std::string_view inputBuffer, bool conditionalMultiplicationEvaluationEnabled);
+		/// The buffer is split into equally sized chunks that are scanned by separate threads (zero will use the number of hardware threads).
+		[[nodiscard]] static long processMultiplicationsFromBuffer(std::string_view inputBuffer, bool conditionalMultiplicationEvaluationEnabled, std::size_t numThreads);
+		/// Uses the same scanner as the determination of the sum, the arrays are sized by a first pass that only counts the instructions.
+		[[nodiscard]] static ExtractedInstructions extractInstructionsFromBuffer(std::string_view inputBuffer);
 
-		constexpr friend KeywordCharacterFlags& operator |=(KeywordCharacterFlags& lFlag, KeywordCharacterFlags rFlag)
+		/// Evaluates the instructions of the given descriptors, the products and sums of the operands are only added to the sum while the evaluation is enabled.
+		template <typename... InstructionDescriptors>
+		[[nodiscard]] static long processInstructionsFromBuffer(std::string_view inputBuffer)
 		{
-			return lFlag = lFlag | rFlag;
+			using Scanner = InstructionScanner<InstructionDescriptors...>;
+			long determinedSum = 0;
+			bool evaluationEnabled = true;
+			typename Scanner::Context scannerContext = Scanner::makeInitialContext();
+			Scanner::scanInstructions(inputBuffer, 0, inputBuffer.size(), scannerContext, [&](auto instructionSemantics, const typename Scanner::Context& context)
+			{
+				applyInstruction<decltype(instructionSemantics)::value>(context.operands, determinedSum, evaluationEnabled);
+			});
+			return determinedSum;
 		}
+	protected:
+		using MultiplicationScanner = InstructionScanner<MulInstruction>;
+		using ConditionalMultiplicationScanner = InstructionScanner<MulInstruction, DoInstruction, DontInstruction>;
+		static constexpr std::array<KeywordKind, 3> KEYWORD_KINDS_OF_CONDITIONAL_MULTIPLICATION_INSTRUCTIONS = { KeywordKind::Mul, KeywordKind::Do, KeywordKind::Dont };
 
-		constexpr friend KeywordCharacterFlags& operator &=(KeywordCharacterFlags& lFlag, KeywordCharacterFlags rFlag)
+		/// Since the state of the multiplications at the start of a chunk is only known after all previous chunks were scanned, the sum and final state of a chunk are determined for both possible initial states.
+		struct alignas(64) ChunkSummary
 		{
-			return lFlag = lFlag & rFlag;
-		}
+			long sumIfStartedEnabled;
+			long sumIfStartedDisabled;
+			bool enabledAtEndIfStartedEnabled;
+			bool enabledAtEndIfStartedDisabled;
+		};
 
-		constexpr friend KeywordCharacterFlags& operator ^=(KeywordCharacterFlags& lFlag, KeywordCharacterFlags rFlag)
+		static constexpr std::size_t MIN_NUM_BYTES_PER_THREAD = 1 << 16;
+		static constexpr std::size_t INPUT_FILE_BLOCK_SIZE_IN_BYTES = 1 << 16;
+
+		template <InstructionSemantics Semantics, std::size_t NumOperands>
+		static void applyInstruction(const std::array<InstructionOperand, NumOperands>& operands, long& determinedSum, bool& evaluationEnabled) noexcept
 		{
-			return lFlag = lFlag ^ rFlag;
+			if constexpr (Semantics == InstructionSemantics::AddProductOfOperands)
+			{
+				long product = 1;
+				for (const InstructionOperand operand : operands)
+					product *= operand;
+				determinedSum += evaluationEnabled ? product : 0;
+			}
+			else if constexpr (Semantics == InstructionSemantics::AddSumOfOperands)
+			{
+				long sum = 0;
+				for (const InstructionOperand operand : operands)
+					sum += operand;
+				determinedSum += evaluationEnabled ? sum : 0;
+			}
+			else
+				evaluationEnabled = Semantics == InstructionSemantics::EnableEvaluation;
 		}
 
-		[[nodiscard]] static long processMultiplicationsFromStream(std::istream& inputStream, bool conditionalMultiplicationEvaluationEnabled);
-		[[maybe_unused]] static bool searchForKeywordPrefix(std::istream& inputStream, KeywordKind& processedKeywordPrefix, bool conditionalMultiplicationEvaluationEnabled);
-		[[maybe_unused]] static bool extractNumberFromStream(std::istream& inputStream, std::optional<MultiplicationFactor>& extractedNumberContainer);
-		[[maybe_unused]] static bool checkIfNextCharacterInStreamIs(std::istream& inputStream, char expectedCharacter);
-		static constexpr void setFlagInAggregateWhenEqualToOtherwiseReset(KeywordCharacterFlags& aggregate, KeywordCharacterFlags expectedValue, KeywordCharacterFlags valueToSet) noexcept
+		/// Processes all instructions starting in the range [firstByteOffset, lastByteOffset) for both possible initial states of the evaluation.
+		template <typename Scanner>
+		[[nodiscard]] static ChunkSummary summarizeChunkUsingScanner(std::string_view inputBuffer, std::size_t firstByteOffset, std::size_t lastByteOffset) noexcept
 		{
-			aggregate ^= aggregate == expectedValue ? valueToSet : aggregate;
+			ChunkSummary chunkSummary{ 0, 0, true, false };
+			typename Scanner::Context scannerContext = Scanner::makeInitialContext();
+			Scanner::scanInstructions(inputBuffer, firstByteOffset, lastByteOffset, scannerContext, [&chunkSummary](auto instructionSemantics, const typename Scanner::Context& context)
+			{
+				applyInstruction<decltype(instructionSemantics)::value>(context.operands, chunkSummary.sumIfStartedEnabled, chunkSummary.enabledAtEndIfStartedEnabled);
+				applyInstruction<decltype(instructionSemantics)::value>(context.operands, chunkSummary.sumIfStartedDisabled, chunkSummary.enabledAtEndIfStartedDisabled);
+			});
+			return chunkSummary;
 		}
+
+		/// Processes all instructions starting in the range [firstByteOffset, lastByteOffset), an instruction straddling the end of the range is owned by this chunk and parsed using the characters following the range.
+		[[nodiscard]] static ChunkSummary summarizeChunk(std::string_view inputBuffer, std::size_t firstByteOffset, std::size_t lastByteOffset, bool conditionalMultiplicationEvaluationEnabled) noexcept;
+		static void applyChunkSummary(const ChunkSummary& chunkSummary, long& determinedSum, bool& multiplicationsEnabled) noexcept;
 	};
 }
 
-#endif
\ No newline at end of file
+#endif
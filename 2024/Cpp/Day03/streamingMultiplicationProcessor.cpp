@@ -0,0 +1,23 @@
+#include "streamingMultiplicationProcessor.hpp"
+
+using namespace Day03;
+
+StreamingMultiplicationProcessor::StreamingMultiplicationProcessor(bool conditionalMultiplicationEvaluationEnabled)
+	: conditionalMultiplicationEvaluationEnabled(conditionalMultiplicationEvaluationEnabled), multiplicationsEnabled(true), determinedSum(0),
+	scannerContext(ConditionalMultiplicationScanner::makeInitialContext())
+{}
+
+void StreamingMultiplicationProcessor::feed(std::string_view inputChunk)
+{
+	ConditionalMultiplicationScanner::scanInstructions(inputChunk, 0, inputChunk.size(), scannerContext, [this](auto instructionSemantics, const ConditionalMultiplicationScanner::Context& context)
+	{
+		constexpr InstructionSemantics semantics = decltype(instructionSemantics)::value;
+		if (conditionalMultiplicationEvaluationEnabled || semantics == InstructionSemantics::AddProductOfOperands)
+			applyInstruction<semantics>(context.operands, determinedSum, multiplicationsEnabled);
+	});
+}
+
+long StreamingMultiplicationProcessor::currentSum() const noexcept
+{
+	return determinedSum;
+}
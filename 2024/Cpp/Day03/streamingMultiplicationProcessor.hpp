@@ -0,0 +1,26 @@
+#ifndef DAY03_STREAMING_MULTIPLICATION_PROCESSOR_HPP
+#define DAY03_STREAMING_MULTIPLICATION_PROCESSOR_HPP
+
+#include "multiplicationProcessor.hpp"
+
+#include <string_view>
+
+namespace Day03 {
+	/// Maintains the sum of the multiplications of an unbounded input that is fed in consecutive chunks. The scan of an instruction that is still incomplete at the end of a chunk is
+	/// resumed with the next one, thus only the state of the scanner and the already parsed factors are stored between the chunks.
+	class StreamingMultiplicationProcessor : protected MultiplicationProcessor {
+	public:
+		explicit StreamingMultiplicationProcessor(bool conditionalMultiplicationEvaluationEnabled);
+
+		void feed(std::string_view inputChunk);
+		[[nodiscard]] long currentSum() const noexcept;
+
+	protected:
+		bool conditionalMultiplicationEvaluationEnabled;
+		bool multiplicationsEnabled;
+		long determinedSum;
+		ConditionalMultiplicationScanner::Context scannerContext;
+	};
+}
+
+#endif
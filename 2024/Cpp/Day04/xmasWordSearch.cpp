@@ -1,6 +1,8 @@
 #include "xmasWordSearch.hpp"
 
+#include <algorithm>
 #include <fstream>
+#include <iterator>
 #include <sstream>
 
 using namespace Day04;
@@ -32,39 +34,31 @@ std::size_t XmasWordSearch::countMasCrossOccurrencesInString(const std::string&
 // START NON-PUBLIC FUNCTIONALITY
 std::size_t XmasWordSearch::countXmasOccurrencesIn(std::istream& inputStream)
 {
-	const WordField worldField = parseWordFieldFromStream(inputStream, WordFieldCharFlag::Unknown);
-	if (!worldField.xmasCharacters)
+	const std::optional<WordField> parsedWorldField = parseWordFieldFromStream(inputStream, WordFieldCharFlag::Unknown);
+	if (!parsedWorldField)
 		return 0;
 
 	std::size_t foundXmasCombinationsCount = 0;
-	const WordFieldXmasCharactersLookup& xmasCharacterLookup = *worldField.xmasCharacters;
-	const bool globalVerticalChecksEnabled = worldField.rows >= 4;
-	const bool globalHorizontalChecksEnabled = worldField.cols >= 4;
-	const bool globalDiagonalChecksEnabled = globalVerticalChecksEnabled && globalHorizontalChecksEnabled;
-
-	for (const auto& xmasCharactersInRowInField : xmasCharacterLookup)
+	const WordField& worldField = *parsedWorldField;
+	for (std::size_t row = 0; row < worldField.rows; ++row)
 	{
-		for (const auto& xmasCharactersInColOfRow : xmasCharactersInRowInField.second) 
+		for (std::size_t col = 0; col < worldField.cols; ++col)
 		{
-			const WorldFieldCellIndex cellIndex = { xmasCharactersInRowInField.first, xmasCharactersInColOfRow.first };
-			const bool canPerformChecksToTheRight = globalHorizontalChecksEnabled && cellIndex.col < worldField.cols - 3;
-			const bool canPerformChecksToTheLeft = globalHorizontalChecksEnabled && cellIndex.col >= 3;
-			const bool canPerformUpwardChecks = globalVerticalChecksEnabled && cellIndex.row >= 3;
-			const bool canPerformDownwardChecks = globalVerticalChecksEnabled && cellIndex.row <= worldField.rows - 3;
+			const WorldFieldCellIndex cellIndex = { row, col };
 
 			constexpr int DOWNWARD_VERTICAL_OFFSET = 1;
 			constexpr int LEFT_HORIZONTAL_OFFSET = -1;
 
 			foundXmasCombinationsCount += 
-				xmasCharactersInColOfRow.second == XmasWordSearch::WordFieldCharFlag::X
-				? doesCellCombinationContainXmas(worldField, cellIndex, LEFT_HORIZONTAL_OFFSET, 0, canPerformChecksToTheLeft)		// CENTER to LEFT
-				+ doesCellCombinationContainXmas(worldField, cellIndex, -LEFT_HORIZONTAL_OFFSET, 0, canPerformChecksToTheRight)		// CENTER to RIGHT
-				+ doesCellCombinationContainXmas(worldField, cellIndex, 0, -DOWNWARD_VERTICAL_OFFSET, canPerformUpwardChecks)		// CENTER to TOP
-				+ doesCellCombinationContainXmas(worldField, cellIndex, 0, DOWNWARD_VERTICAL_OFFSET, canPerformDownwardChecks)	// CENTER to BOTTOM 
-				+ doesCellCombinationContainXmas(worldField, cellIndex, LEFT_HORIZONTAL_OFFSET, -DOWNWARD_VERTICAL_OFFSET, globalDiagonalChecksEnabled && canPerformChecksToTheLeft && canPerformUpwardChecks)	// CENTER to TOP LEFT
-				+ doesCellCombinationContainXmas(worldField, cellIndex, -LEFT_HORIZONTAL_OFFSET, -DOWNWARD_VERTICAL_OFFSET, globalDiagonalChecksEnabled && canPerformChecksToTheRight && canPerformUpwardChecks)	// CENTER to TOP RIGHT
-				+ doesCellCombinationContainXmas(worldField, cellIndex, LEFT_HORIZONTAL_OFFSET, DOWNWARD_VERTICAL_OFFSET, globalDiagonalChecksEnabled && canPerformChecksToTheLeft && canPerformDownwardChecks)	// CENTER to BOTTOM LEFT
-				+ doesCellCombinationContainXmas(worldField, cellIndex, -LEFT_HORIZONTAL_OFFSET, DOWNWARD_VERTICAL_OFFSET, globalDiagonalChecksEnabled && canPerformChecksToTheRight && canPerformDownwardChecks)	// CENTER to BOTTOM RIGHT
+				getCharacterInCellOfField(worldField, cellIndex) == XmasWordSearch::WordFieldCharFlag::X
+				? doesCellCombinationContainXmas(worldField, cellIndex, LEFT_HORIZONTAL_OFFSET, 0)		// CENTER to LEFT
+				+ doesCellCombinationContainXmas(worldField, cellIndex, -LEFT_HORIZONTAL_OFFSET, 0)		// CENTER to RIGHT
+				+ doesCellCombinationContainXmas(worldField, cellIndex, 0, -DOWNWARD_VERTICAL_OFFSET)		// CENTER to TOP
+				+ doesCellCombinationContainXmas(worldField, cellIndex, 0, DOWNWARD_VERTICAL_OFFSET)	// CENTER to BOTTOM 
+				+ doesCellCombinationContainXmas(worldField, cellIndex, LEFT_HORIZONTAL_OFFSET, -DOWNWARD_VERTICAL_OFFSET)	// CENTER to TOP LEFT
+				+ doesCellCombinationContainXmas(worldField, cellIndex, -LEFT_HORIZONTAL_OFFSET, -DOWNWARD_VERTICAL_OFFSET)	// CENTER to TOP RIGHT
+				+ doesCellCombinationContainXmas(worldField, cellIndex, LEFT_HORIZONTAL_OFFSET, DOWNWARD_VERTICAL_OFFSET)	// CENTER to BOTTOM LEFT
+				+ doesCellCombinationContainXmas(worldField, cellIndex, -LEFT_HORIZONTAL_OFFSET, DOWNWARD_VERTICAL_OFFSET)	// CENTER to BOTTOM RIGHT
 				: 0;
 		}
 	}
@@ -73,21 +67,18 @@ std::size_t XmasWordSearch::countXmasOccurrencesIn(std::istream& inputStream)
 
 std::size_t XmasWordSearch::countMasCrossOccurrencesIn(std::istream& inputStream)
 {
-	const WordField worldField = parseWordFieldFromStream(inputStream, WordFieldCharFlag::X);
-	if (!worldField.xmasCharacters || worldField.cols < 3 || worldField.rows < 3)
+	const std::optional<WordField> parsedWorldField = parseWordFieldFromStream(inputStream, WordFieldCharFlag::X);
+	if (!parsedWorldField)
 		return 0;
 
 	std::size_t foundMasCrossCombinations = 0;
-	const WordFieldXmasCharactersLookup& xmasCharacterLookup = *worldField.xmasCharacters;
-	for (const auto& xmasCharactersInRowInField : xmasCharacterLookup)
+	const WordField& worldField = *parsedWorldField;
+	for (std::size_t row = 0; row < worldField.rows; ++row)
 	{
-		for (const auto& xmasCharactersInColOfRow : xmasCharactersInRowInField.second) 
+		for (std::size_t col = 0; col < worldField.cols; ++col)
 		{
-			const WorldFieldCellIndex cellIndex = { xmasCharactersInRowInField.first, xmasCharactersInColOfRow.first };
-			const bool canPerformCheck = cellIndex.row >= 1 && cellIndex.row <= worldField.rows - 2
-				&& cellIndex.col >= 1 && cellIndex.col <= worldField.cols - 2;
-
-			foundMasCrossCombinations += canPerformCheck && xmasCharactersInColOfRow.second == XmasWordSearch::WordFieldCharFlag::A && doesCellCombinationContainMas(worldField, cellIndex);
+			const WorldFieldCellIndex cellIndex = { row, col };
+			foundMasCrossCombinations += getCharacterInCellOfField(worldField, cellIndex) == XmasWordSearch::WordFieldCharFlag::A && doesCellCombinationContainMas(worldField, cellIndex);
 		}
 	}
 	return foundMasCrossCombinations;
@@ -97,19 +88,22 @@ std::size_t XmasWordSearch::countMasCrossOccurrencesIn(std::istream& inputStream
  * To process the MAS cross combinations, one could also use a sliding window approach during the processing of the input file instead of building the character lookup to be processed latter.
  * Using a similar approach to determine the XMAS combinations does not seems viable for now due to the large number of checks involved but further investigations were not performed.
  */
-XmasWordSearch::WordField XmasWordSearch::parseWordFieldFromStream(std::istream& inputStream, WordFieldCharFlag aggregateFlagOfXmasCharactersToIgnore)
+std::optional<XmasWordSearch::WordField> XmasWordSearch::parseWordFieldFromStream(std::istream& inputStream, WordFieldCharFlag aggregateFlagOfXmasCharactersToIgnore)
 {
-	auto xmasCharactersLookupInstance = std::make_unique<XmasWordSearch::WordFieldXmasCharactersLookup>();
-	XmasWordSearch::WordFieldXmasCharactersLookup& xmasCharacterLookup = *xmasCharactersLookupInstance;
+	if (!inputStream)
+		return std::nullopt;
 
-	std::size_t numColsInField = 0;
+	const std::string content((std::istreambuf_iterator<char>(inputStream)), std::istreambuf_iterator<char>());
+	if (inputStream.bad())
+		return std::nullopt;
+
+	// The dimensions of the field need to be known before the grid can be allocated
+	std::size_t maxNumColsInRow = 0;
 	std::size_t row = 0;
 	std::size_t col = 0;
-
-	char lastProcessedCharacter;
-	while ((lastProcessedCharacter = static_cast<char>(inputStream.get())) != EOF)
+	for (const char character : content)
 	{
-		switch (lastProcessedCharacter)
+		switch (character)
 		{
 			case '\r': 
 			{
@@ -122,41 +116,48 @@ XmasWordSearch::WordField XmasWordSearch::parseWordFieldFromStream(std::istream&
 			case '\n':
 			{
 				++row;
-				numColsInField = col;
 				col = 0;
-				xmasCharacterLookup[row] = XmasWordSearch::WorldFieldRow();
 				break;
 			}
 			default:
-				if (const WordFieldCharFlag mappedToFlagForCharacter = mapCharacterToFlagValue(lastProcessedCharacter); mappedToFlagForCharacter != WordFieldCharFlag::Unknown 
-					&& (mappedToFlagForCharacter & aggregateFlagOfXmasCharactersToIgnore) == WordFieldCharFlag::Unknown)
-					xmasCharacterLookup[row][col++] = mappedToFlagForCharacter;
-				else
-					++col;
+				maxNumColsInRow = std::max(maxNumColsInRow, ++col);
 				break;
 		}
 	}
 	++row;
-	// If no newline character is found in grid than we need to add one line to our row counter
-	return { row, !numColsInField ? col : numColsInField, std::move(xmasCharactersLookupInstance) };
+
+	// The last row is not terminated by a newline character, rows shorter than the widest one are filled up with Unknown cells
+	WordField wordField{ row, maxNumColsInRow, maxNumColsInRow + 2 * NUM_PADDING_CELLS, {} };
+	wordField.cells.resize((wordField.rows + 2 * NUM_PADDING_CELLS) * wordField.rowStride, WordFieldCharFlag::Unknown);
+
+	WordFieldCharFlag* cellsOfRow = wordField.cells.data() + NUM_PADDING_CELLS * wordField.rowStride + NUM_PADDING_CELLS;
+	col = 0;
+	for (const char character : content)
+	{
+		if (character == '\n')
+		{
+			cellsOfRow += wordField.rowStride;
+			col = 0;
+		}
+		else if (character != '\r')
+		{
+			if (const WordFieldCharFlag mappedToFlagForCharacter = mapCharacterToFlagValue(character); (mappedToFlagForCharacter & aggregateFlagOfXmasCharactersToIgnore) == WordFieldCharFlag::Unknown)
+				cellsOfRow[col] = mappedToFlagForCharacter;
+			++col;
+		}
+	}
+	return wordField;
 }
 
 XmasWordSearch::WordFieldCharFlag XmasWordSearch::getCharacterInCellOfField(const WordField& wordField, WorldFieldCellIndex cellIndex)
 {
-	if (cellIndex.row > wordField.rows || cellIndex.col > wordField.cols)
-		return XmasWordSearch::Unknown;
-
-	const WordFieldXmasCharactersLookup& charactersLookup = *wordField.xmasCharacters;
-	if (!charactersLookup.count(cellIndex.row) || !charactersLookup.at(cellIndex.row).count(cellIndex.col))
-		return XmasWordSearch::Unknown;
-
-	return charactersLookup.at(cellIndex.row).at(cellIndex.col);
+	// An underflowing cell index wraps around and is brought back into the padding by the offset of the padding cells
+	return wordField.cells[(cellIndex.row + NUM_PADDING_CELLS) * wordField.rowStride + cellIndex.col + NUM_PADDING_CELLS];
 }
 
-bool XmasWordSearch::doesCellCombinationContainXmas(const WordField& worldField, WorldFieldCellIndex originCellIndex, int horizontalOffset, int verticalOffset, bool checkEnabled)
+bool XmasWordSearch::doesCellCombinationContainXmas(const WordField& worldField, WorldFieldCellIndex originCellIndex, int horizontalOffset, int verticalOffset)
 {
-	return checkEnabled
-		&& getCharacterInCellOfField(worldField, originCellIndex) == WordFieldCharFlag::X
+	return getCharacterInCellOfField(worldField, originCellIndex) == WordFieldCharFlag::X
 		&& getCharacterInCellOfField(worldField, { originCellIndex.row + verticalOffset, originCellIndex.col + horizontalOffset }) == WordFieldCharFlag::M
 		&& getCharacterInCellOfField(worldField, { originCellIndex.row + 2 * verticalOffset, originCellIndex.col + 2 * horizontalOffset }) == WordFieldCharFlag::A
 		&& getCharacterInCellOfField(worldField, { originCellIndex.row + 3 * verticalOffset, originCellIndex.col + 3 * horizontalOffset }) == WordFieldCharFlag::S;
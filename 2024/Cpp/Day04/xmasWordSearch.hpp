@@ -1,10 +1,9 @@
 #ifndef DAY04_XMAS_WORD_SEARCH_HPP
 #define DAY04_XMAS_WORD_SEARCH_HPP
 
-#include <map>
-#include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace Day04 {
 	class XmasWordSearch {
@@ -78,13 +77,18 @@ namespace Day04 {
 			S = 8
 		};
 
-		using WorldFieldRow = std::map<std::size_t, WordFieldCharFlag, std::less<>>;
-		using WordFieldXmasCharactersLookup = std::map<std::size_t, WorldFieldRow, std::less<>>;
+		// Every cell within the distance of the last character of XMAS to a cell of the field can be accessed without any bounds checks
+		static constexpr std::size_t NUM_PADDING_CELLS = 3;
+
+		/// The characters of the field are stored row by row in a flat grid that is surrounded by padding cells holding the Unknown flag, thus a row of the grid is wider than the field by twice the padding.
+		/// The number of columns is the one of the widest row, shorter rows are filled up with Unknown cells. The searches do not check the bounds of the field but rely on the padding,
+		/// a combination reaching beyond the field hits an Unknown cell and is thus not matched.
 		struct WordField
 		{
 			std::size_t rows;
 			std::size_t cols;
-			std::unique_ptr<WordFieldXmasCharactersLookup> xmasCharacters;
+			std::size_t rowStride;
+			std::vector<WordFieldCharFlag> cells;
 		};
 
 		struct WorldFieldCellIndex
@@ -95,7 +99,7 @@ namespace Day04 {
 
 		[[nodiscard]] static std::size_t countXmasOccurrencesIn(std::istream& inputStream);
 		[[nodiscard]] static std::size_t countMasCrossOccurrencesIn(std::istream& inputStream);
-		[[nodiscard]] static WordField parseWordFieldFromStream(std::istream& inputStream, WordFieldCharFlag aggregateFlagOfXmasCharactersToIgnore);
+		[[nodiscard]] static std::optional<WordField> parseWordFieldFromStream(std::istream& inputStream, WordFieldCharFlag aggregateFlagOfXmasCharactersToIgnore);
 		[[nodiscard]] static constexpr WordFieldCharFlag mapCharacterToFlagValue(char character)
 		{
 			switch (character)
@@ -116,8 +120,9 @@ namespace Day04 {
 				return WordFieldCharFlag::Unknown;
 			}
 		}
+		/// Cells outside of the field are only accessible up to the width of the padding, i.e. the cell index can underflow by at most NUM_PADDING_CELLS.
 		[[nodiscard]] static WordFieldCharFlag getCharacterInCellOfField(const WordField& wordField, WorldFieldCellIndex cellIndex);
-		[[nodiscard]] static bool doesCellCombinationContainXmas(const WordField& worldField, WorldFieldCellIndex originCellIndex, int horizontalOffset, int verticalOffset, bool checkEnabled);
+		[[nodiscard]] static bool doesCellCombinationContainXmas(const WordField& worldField, WorldFieldCellIndex originCellIndex, int horizontalOffset, int verticalOffset);
 		[[nodiscard]] static bool doesCellCombinationContainMas(const WordField& worldField, WorldFieldCellIndex originCellIndex);
 		[[nodiscard]] static constexpr bool doCharactersFormMasCombination(WordFieldCharFlag firstCharacter, WordFieldCharFlag secondCharacter, WordFieldCharFlag thirdCharacter)
 		{
@@ -4,6 +4,7 @@
 #include <fstream>
 #include <sstream>
 #include <unordered_set>
+#include <vector>
 
 using namespace Day06;
 
@@ -32,10 +33,28 @@ std::optional<std::size_t> WardPositions::getNumberOfAdditionalObstaclePositions
 }
 
 // START NONE-PUBLIC INTERFACE
-std::optional<WardPositions::AsciiMapProcessingResult> WardPositions::processAsciiMap(std::istream& inputStream)
+std::optional<std::size_t> WardPositions::getNumberOfPotentialWardPositionsForMapFromStream(std::istream& inputStream)
+{
+	return utils::processAsciiMapUsingNarrowestCoordinateType(inputStream, [](std::istream& stream, auto coordinateTypeTag, bool& exceededCoordinateRange)
+	{
+		return getNumberOfPotentialWardPositionsForMapFromStream<decltype(coordinateTypeTag)>(stream, exceededCoordinateRange);
+	});
+}
+
+std::optional<std::size_t> WardPositions::getNumberOfAdditionalObstaclePositionsCausingLoopForMapFromStream(std::istream& inputStream)
+{
+	return utils::processAsciiMapUsingNarrowestCoordinateType(inputStream, [](std::istream& stream, auto coordinateTypeTag, bool& exceededCoordinateRange)
+	{
+		return getNumberOfAdditionalObstaclePositionsCausingLoopForMapFromStream<decltype(coordinateTypeTag)>(stream, exceededCoordinateRange);
+	});
+}
+
+template <typename Coordinate>
+std::optional<WardPositions::AsciiMapProcessingResult<Coordinate>> WardPositions::processAsciiMap(std::istream& inputStream, bool& exceededCoordinateRange)
 {
-	utils::AsciiMapProcessor<WardMovementMapEntryTypes> asciiWardMovementProcessor;
-	utils::AsciiMapProcessor<WardMovementMapEntryTypes>::CharacterToEnumMapping asciiWardMovementCharacterMappings = {
+	using AsciiWardMovementProcessor = utils::AsciiMapProcessor<WardMovementMapEntryTypes, Coordinate>;
+	AsciiWardMovementProcessor asciiWardMovementProcessor;
+	typename AsciiWardMovementProcessor::CharacterToEnumMapping asciiWardMovementCharacterMappings = {
 		{ASCII_WARD_INITIAL_POSITION_FACING_UPWARD, WardMovementMapEntryTypes::WardInitialPositionFacingUpward},
 		{ASCII_WARD_INITIAL_POSITION_FACING_DOWNWARD, WardMovementMapEntryTypes::WardInitialPositionFacingDownward},
 		{ASCII_WARD_INITIAL_POSITION_FACING_LEFT, WardMovementMapEntryTypes::WardInitialPositionFacingLeft},
@@ -43,80 +62,86 @@ std::optional<WardPositions::AsciiMapProcessingResult> WardPositions::processAsc
 		{ASCII_OBSTACLE, WardMovementMapEntryTypes::Obstacle}
 	};
 
-	utils::AsciiMapProcessor<WardMovementMapEntryTypes>::AsciiMapProcessingResult lastFoundRelevantAsciiMapEntry;
-
 	std::size_t numProcessedWardInitialPositions = 0;
 	auto initialWardOrientation = WardOrientation::Upward;
-	utils::AsciiMapPosition initialWardPosition;
-	ObstacleLookup obstaclePositions;
+	MapPosition<Coordinate> initialWardPosition;
+	std::vector<utils::AsciiMapElement<WardMovementMapEntryTypes, Coordinate>> obstaclePositions;
+	std::vector<utils::AsciiMapElement<WardMovementMapEntryTypes, Coordinate>> relevantElementsOfRow;
 
-	while (asciiWardMovementProcessor.findNextElement(inputStream, &asciiWardMovementCharacterMappings, lastFoundRelevantAsciiMapEntry, true) && lastFoundRelevantAsciiMapEntry.data.has_value())
+	auto rowProcessingStopageReason = AsciiWardMovementProcessor::Newline;
+	while (rowProcessingStopageReason == AsciiWardMovementProcessor::Newline)
 	{
-		const WardMovementMapEntryTypes relevantElement = *lastFoundRelevantAsciiMapEntry.data;
-		const utils::AsciiMapPosition positionOfRelevantElement = lastFoundRelevantAsciiMapEntry.position;
-		switch (relevantElement)
-		{
-		case WardMovementMapEntryTypes::Obstacle:
-			obstaclePositions.emplace(positionOfRelevantElement);
-			break;
-		case WardInitialPositionFacingUpward:
-		{
-			initialWardOrientation = WardOrientation::Upward;
-			initialWardPosition = positionOfRelevantElement;
-			++numProcessedWardInitialPositions;
-			break;
-		}
-		case WardInitialPositionFacingDownward:
-		{
-			initialWardOrientation = WardOrientation::Downward;
-			initialWardPosition = positionOfRelevantElement;
-			++numProcessedWardInitialPositions;
-			break;
-		}
-		case WardInitialPositionFacingLeft:
+		relevantElementsOfRow.clear();
+		rowProcessingStopageReason = asciiWardMovementProcessor.appendElementsOfNextRow(inputStream, &asciiWardMovementCharacterMappings, relevantElementsOfRow);
+		for (const auto& [positionOfRelevantElement, relevantElement] : relevantElementsOfRow)
 		{
-			initialWardOrientation = WardOrientation::Left;
-			initialWardPosition = positionOfRelevantElement;
-			++numProcessedWardInitialPositions;
-			break;
-		}
-		case WardInitialPositionFacingRight:
-		{
-			initialWardOrientation = WardOrientation::Right;
-			initialWardPosition = positionOfRelevantElement;
-			++numProcessedWardInitialPositions;
-			break;
-		}
-		// This case should not happen because processing of the stream should continue if no mapping for the processed character of the stream exists with no relevant element being reported for the character.
-		default:
-			return std::nullopt;
+			switch (relevantElement)
+			{
+			case WardMovementMapEntryTypes::Obstacle:
+				obstaclePositions.emplace_back(positionOfRelevantElement, relevantElement);
+				break;
+			case WardInitialPositionFacingUpward:
+			{
+				initialWardOrientation = WardOrientation::Upward;
+				initialWardPosition = positionOfRelevantElement;
+				++numProcessedWardInitialPositions;
+				break;
+			}
+			case WardInitialPositionFacingDownward:
+			{
+				initialWardOrientation = WardOrientation::Downward;
+				initialWardPosition = positionOfRelevantElement;
+				++numProcessedWardInitialPositions;
+				break;
+			}
+			case WardInitialPositionFacingLeft:
+			{
+				initialWardOrientation = WardOrientation::Left;
+				initialWardPosition = positionOfRelevantElement;
+				++numProcessedWardInitialPositions;
+				break;
+			}
+			case WardInitialPositionFacingRight:
+			{
+				initialWardOrientation = WardOrientation::Right;
+				initialWardPosition = positionOfRelevantElement;
+				++numProcessedWardInitialPositions;
+				break;
+			}
+			// This case should not happen because processing of the stream should continue if no mapping for the processed character of the stream exists with no relevant element being reported for the character.
+			default:
+				return std::nullopt;
+			}
 		}
 	}
 
-	if (lastFoundRelevantAsciiMapEntry.streamProcessingStopageReason != utils::AsciiMapProcessor<Day06::WardPositions::WardMovementMapEntryTypes>::EndOfFile || numProcessedWardInitialPositions != 1)
+	exceededCoordinateRange = rowProcessingStopageReason == AsciiWardMovementProcessor::CoordinateOverflow;
+	if (rowProcessingStopageReason != AsciiWardMovementProcessor::EndOfFile || numProcessedWardInitialPositions != 1)
 		return std::nullopt;
 
-	return AsciiMapProcessingResult{ initialWardOrientation, initialWardPosition, asciiWardMovementProcessor.determineMapBounderies(), obstaclePositions };
+	const MapPosition<Coordinate> mapDimensions = asciiWardMovementProcessor.determineMapBounderies();
+	return AsciiMapProcessingResult<Coordinate>{ initialWardOrientation, initialWardPosition, mapDimensions, ObstacleLookup<Coordinate>::fromElements(mapDimensions, std::move(obstaclePositions)) };
 }
 
-std::optional<std::size_t> WardPositions::getNumberOfPotentialWardPositionsForMapFromStream(std::istream& inputStream)
+template <typename Coordinate>
+std::optional<std::size_t> WardPositions::getNumberOfPotentialWardPositionsForMapFromStream(std::istream& inputStream, bool& exceededCoordinateRange)
 {
-	const std::optional<AsciiMapProcessingResult> asciiMapProcessingResult = processAsciiMap(inputStream);
+	const std::optional<AsciiMapProcessingResult<Coordinate>> asciiMapProcessingResult = processAsciiMap<Coordinate>(inputStream, exceededCoordinateRange);
 	if (!asciiMapProcessingResult.has_value())
 		return std::nullopt;
 
-	utils::AsciiMapPosition currWardPosition = asciiMapProcessingResult->initialWardPosition;
-	utils::AsciiMapPosition mapDimensions = asciiMapProcessingResult->mapDimensions;
+	MapPosition<Coordinate> currWardPosition = asciiMapProcessingResult->initialWardPosition;
+	MapPosition<Coordinate> mapDimensions = asciiMapProcessingResult->mapDimensions;
 	WardOrientation currWardOrientation = asciiMapProcessingResult->initialWardOrientation;
-	const ObstacleLookup& foundObstaclePositions = asciiMapProcessingResult->obstaclePositions;
+	const ObstacleLookup<Coordinate>& foundObstaclePositions = asciiMapProcessingResult->obstaclePositions;
 
 	bool outOfBounds = false;
-	WardMovementPathLookup visitedCells;
+	WardMovementPathLookup<Coordinate> visitedCells;
 	OrientationMovementOffset wardMovementOffset = determineMovementOffsetForWardHeading(currWardOrientation);
 
 	while (!outOfBounds && (visitedCells.count(currWardPosition) ? (visitedCells[currWardPosition] & currWardOrientation) != currWardOrientation : true))
 	{
-		if (foundObstaclePositions.count(currWardPosition))
+		if (foundObstaclePositions.containsElementAt(currWardPosition))
 		{
 			placeWardInfrontOfHitObstacleAndRotate(currWardPosition, currWardOrientation, wardMovementOffset);
 		}
@@ -134,27 +159,28 @@ std::optional<std::size_t> WardPositions::getNumberOfPotentialWardPositionsForMa
 	return visitedCells.size();
 }
 
-std::optional<std::size_t> WardPositions::getNumberOfAdditionalObstaclePositionsCausingLoopForMapFromStream(std::istream& inputStream)
+template <typename Coordinate>
+std::optional<std::size_t> WardPositions::getNumberOfAdditionalObstaclePositionsCausingLoopForMapFromStream(std::istream& inputStream, bool& exceededCoordinateRange)
 {
-	const std::optional<AsciiMapProcessingResult> asciiMapProcessingResult = processAsciiMap(inputStream);
+	const std::optional<AsciiMapProcessingResult<Coordinate>> asciiMapProcessingResult = processAsciiMap<Coordinate>(inputStream, exceededCoordinateRange);
 	if (!asciiMapProcessingResult.has_value())
 		return std::nullopt;
 
-	utils::AsciiMapPosition currWardPosition = asciiMapProcessingResult->initialWardPosition;
-	utils::AsciiMapPosition mapDimensions = asciiMapProcessingResult->mapDimensions;
+	MapPosition<Coordinate> currWardPosition = asciiMapProcessingResult->initialWardPosition;
+	MapPosition<Coordinate> mapDimensions = asciiMapProcessingResult->mapDimensions;
 	WardOrientation currWardOrientation = asciiMapProcessingResult->initialWardOrientation;
-	const ObstacleLookup& foundObstaclePositions = asciiMapProcessingResult->obstaclePositions;
+	const ObstacleLookup<Coordinate>& foundObstaclePositions = asciiMapProcessingResult->obstaclePositions;
 	std::size_t numObstaclesCausingLoops = 0;
 
-	std::unordered_set<utils::AsciiMapPosition, utils::AsciiMapPosition> test;
+	std::unordered_set<MapPosition<Coordinate>, MapPosition<Coordinate>> test;
 
 	bool outOfBounds = false;
-	WardMovementPathLookup visitedCells;
+	WardMovementPathLookup<Coordinate> visitedCells;
 	OrientationMovementOffset wardMovementOffset = determineMovementOffsetForWardHeading(currWardOrientation);
 
 	while (!outOfBounds && (visitedCells.count(currWardPosition) ? (visitedCells[currWardPosition] & currWardOrientation) != currWardOrientation : true))
 	{
-		if (foundObstaclePositions.count(currWardPosition))
+		if (foundObstaclePositions.containsElementAt(currWardPosition))
 		{
 			placeWardInfrontOfHitObstacleAndRotate(currWardPosition, currWardOrientation, wardMovementOffset);
 		}
@@ -166,10 +192,10 @@ std::optional<std::size_t> WardPositions::getNumberOfAdditionalObstaclePositions
 				visitedCells[currWardPosition] |= currWardOrientation;
 
 			// BEGIN CHECK FOR LOOP IF PLACING OBSTACLE IN CURRENT CELL
-			if (utils::AsciiMapPosition potentialObstaclePosition = currWardPosition; potentialObstaclePosition != asciiMapProcessingResult->initialWardPosition)
+			if (MapPosition<Coordinate> potentialObstaclePosition = currWardPosition; potentialObstaclePosition != asciiMapProcessingResult->initialWardPosition)
 			{
 				WardOrientation temporaryWardOrientation = currWardOrientation;
-				utils::AsciiMapPosition temporaryWardPosition = currWardPosition;
+				MapPosition<Coordinate> temporaryWardPosition = currWardPosition;
 				OrientationMovementOffset temporaryWardMovement = wardMovementOffset;
 
 				// We can omit bounds check here since the ward is moved one cell in the new movement direction after hitting an obstacle in the previous iteration or if we have moved along the path of the ward using its
@@ -194,7 +220,8 @@ std::optional<std::size_t> WardPositions::getNumberOfAdditionalObstaclePositions
 	return test.size();
 }
 
-void WardPositions::placeWardInfrontOfHitObstacleAndRotate(utils::AsciiMapPosition& currWardPosition, WardOrientation& currWardOrientation, OrientationMovementOffset& currMovementOffsetForWardOrientation)
+template <typename Coordinate>
+void WardPositions::placeWardInfrontOfHitObstacleAndRotate(MapPosition<Coordinate>& currWardPosition, WardOrientation& currWardOrientation, OrientationMovementOffset& currMovementOffsetForWardOrientation)
 {
 	currWardPosition.row -= currMovementOffsetForWardOrientation.verticalOffset;
 	currWardPosition.col -= currMovementOffsetForWardOrientation.horizontalOffset;
@@ -202,7 +229,8 @@ void WardPositions::placeWardInfrontOfHitObstacleAndRotate(utils::AsciiMapPositi
 	currMovementOffsetForWardOrientation = determineMovementOffsetForWardHeading(currWardOrientation);
 }
 
-bool WardPositions::willWardMovementWithCurrentHeadingLeaveMapBounds(const utils::AsciiMapPosition& wardPosition, WardOrientation wardOrientation, const utils::AsciiMapPosition& mapBounds)
+template <typename Coordinate>
+bool WardPositions::willWardMovementWithCurrentHeadingLeaveMapBounds(const MapPosition<Coordinate>& wardPosition, WardOrientation wardOrientation, const MapPosition<Coordinate>& mapBounds)
 {
 	switch (wardOrientation)
 	{
@@ -219,9 +247,10 @@ bool WardPositions::willWardMovementWithCurrentHeadingLeaveMapBounds(const utils
 	}
 }
 
-bool WardPositions::moveWardUntilLoopIsDetectedOrOutOfBoundsReached(utils::AsciiMapPosition currWardPosition, WardOrientation currWardOrientation, const ObstacleLookup& obstaclesInMapLookup, const utils::AsciiMapPosition& temporaryObstaclePosition, const WardMovementPathLookup& currentWardMovementPath, const utils::AsciiMapPosition& mapBounds)
+template <typename Coordinate>
+bool WardPositions::moveWardUntilLoopIsDetectedOrOutOfBoundsReached(MapPosition<Coordinate> currWardPosition, WardOrientation currWardOrientation, const ObstacleLookup<Coordinate>& obstaclesInMapLookup, const MapPosition<Coordinate>& temporaryObstaclePosition, const WardMovementPathLookup<Coordinate>& currentWardMovementPath, const MapPosition<Coordinate>& mapBounds)
 {
-	WardMovementPathLookup internallyVisitedCells;
+	WardMovementPathLookup<Coordinate> internallyVisitedCells;
 	OrientationMovementOffset wardMovementOffset = determineMovementOffsetForWardHeading(currWardOrientation);
 
 	bool outOfBounds = false;
@@ -231,7 +260,7 @@ bool WardPositions::moveWardUntilLoopIsDetectedOrOutOfBoundsReached(utils::Ascii
 			|| (currentWardMovementPath.count(currWardPosition) && (currentWardMovementPath.at(currWardPosition) & currWardOrientation) == currWardOrientation))
 			return true;
 
-		if (obstaclesInMapLookup.count(currWardPosition) || currWardPosition == temporaryObstaclePosition)
+		if (obstaclesInMapLookup.containsElementAt(currWardPosition) || currWardPosition == temporaryObstaclePosition)
 		{
 			placeWardInfrontOfHitObstacleAndRotate(currWardPosition, currWardOrientation, wardMovementOffset);
 		}
@@ -2,6 +2,7 @@
 #define DAY06_WARD_POSITIONS_HPP
 
 #include "../utils/asciiMapProcessor.hpp"
+#include "../utils/asciiMapStorage.hpp"
 
 #include <optional>
 #include <string>
@@ -44,15 +45,21 @@ namespace Day06 {
 				: horizontalOffset(horizontalOffset), verticalOffset(verticalOffset) {}
 		};
 
-		using ObstacleLookup = std::unordered_set<utils::AsciiMapPosition, utils::AsciiMapPosition>;
-		using WardMovementPathLookup = std::unordered_map<utils::AsciiMapPosition, WardOrientation, utils::AsciiMapPosition>;
+		// The coordinate type of the map positions is chosen based on the dimensions of the processed map
+		template <typename Coordinate>
+		using MapPosition = utils::BasicAsciiMapPosition<Coordinate>;
+		template <typename Coordinate>
+		using ObstacleLookup = utils::AsciiMapStorage<WardMovementMapEntryTypes, Coordinate>;
+		template <typename Coordinate>
+		using WardMovementPathLookup = std::unordered_map<MapPosition<Coordinate>, WardOrientation, MapPosition<Coordinate>>;
 
+		template <typename Coordinate>
 		struct AsciiMapProcessingResult
 		{
 			WardOrientation initialWardOrientation;
-			utils::AsciiMapPosition initialWardPosition;
-			utils::AsciiMapPosition mapDimensions;
-		    ObstacleLookup obstaclePositions;
+			MapPosition<Coordinate> initialWardPosition;
+			MapPosition<Coordinate> mapDimensions;
+		    ObstacleLookup<Coordinate> obstaclePositions;
 		};
 		
 		constexpr static char ASCII_WARD_INITIAL_POSITION_FACING_UPWARD = '^';
@@ -61,9 +68,14 @@ namespace Day06 {
 		constexpr static char ASCII_WARD_INITIAL_POSITION_FACING_RIGHT = '>';
 		constexpr static char ASCII_OBSTACLE = '#';
 
-		[[nodiscard]] static std::optional<AsciiMapProcessingResult> processAsciiMap(std::istream& inputStream);
+		template <typename Coordinate>
+		[[nodiscard]] static std::optional<AsciiMapProcessingResult<Coordinate>> processAsciiMap(std::istream& inputStream, bool& exceededCoordinateRange);
 		[[nodiscard]] static std::optional<std::size_t> getNumberOfPotentialWardPositionsForMapFromStream(std::istream& inputStream);
 		[[nodiscard]] static std::optional<std::size_t> getNumberOfAdditionalObstaclePositionsCausingLoopForMapFromStream(std::istream& inputStream);
+		template <typename Coordinate>
+		[[nodiscard]] static std::optional<std::size_t> getNumberOfPotentialWardPositionsForMapFromStream(std::istream& inputStream, bool& exceededCoordinateRange);
+		template <typename Coordinate>
+		[[nodiscard]] static std::optional<std::size_t> getNumberOfAdditionalObstaclePositionsCausingLoopForMapFromStream(std::istream& inputStream, bool& exceededCoordinateRange);
 
 		[[maybe_unused]] static bool rotateWardOrientationByMinus90Degrees(WardOrientation& currWardOrientation)
 		{
@@ -109,7 +121,8 @@ namespace Day06 {
 			return true;
 		}
 
-		[[nodiscard]] static bool willWardMovementWithCurrentHeadingLeaveMapBounds(const utils::AsciiMapPosition& wardPosition, WardOrientation wardOrientation, const utils::AsciiMapPosition& mapBounds);
+		template <typename Coordinate>
+		[[nodiscard]] static bool willWardMovementWithCurrentHeadingLeaveMapBounds(const MapPosition<Coordinate>& wardPosition, WardOrientation wardOrientation, const MapPosition<Coordinate>& mapBounds);
 		[[nodiscard]] static OrientationMovementOffset determineMovementOffsetForWardHeading(WardOrientation wardOrientation)
 		{
 			switch (wardOrientation)
@@ -126,14 +139,17 @@ namespace Day06 {
 					return OrientationMovementOffset(0, 0);
 			}
 		}
-		static void placeWardInfrontOfHitObstacleAndRotate(utils::AsciiMapPosition& currWardPosition, WardOrientation& currWardOrientation, OrientationMovementOffset& currMovementOffsetForWardOrientation);
-		static void advanceWardPosition(utils::AsciiMapPosition& currWardPosition, const OrientationMovementOffset& currMovementOffsetForWardOrientation)
+		template <typename Coordinate>
+		static void placeWardInfrontOfHitObstacleAndRotate(MapPosition<Coordinate>& currWardPosition, WardOrientation& currWardOrientation, OrientationMovementOffset& currMovementOffsetForWardOrientation);
+		template <typename Coordinate>
+		static void advanceWardPosition(MapPosition<Coordinate>& currWardPosition, const OrientationMovementOffset& currMovementOffsetForWardOrientation)
 		{
 			currWardPosition.row += currMovementOffsetForWardOrientation.verticalOffset;
 			currWardPosition.col += currMovementOffsetForWardOrientation.horizontalOffset;
 		}
 
-		[[nodiscard]] static bool moveWardUntilLoopIsDetectedOrOutOfBoundsReached(utils::AsciiMapPosition currWardPosition, WardOrientation currWardOrientation, const ObstacleLookup& obstaclesInMapLookup, const utils::AsciiMapPosition& temporaryObstaclePosition, const WardMovementPathLookup& currentWardMovementPath, const utils::AsciiMapPosition& mapBounds);
+		template <typename Coordinate>
+		[[nodiscard]] static bool moveWardUntilLoopIsDetectedOrOutOfBoundsReached(MapPosition<Coordinate> currWardPosition, WardOrientation currWardOrientation, const ObstacleLookup<Coordinate>& obstaclesInMapLookup, const MapPosition<Coordinate>& temporaryObstaclePosition, const WardMovementPathLookup<Coordinate>& currentWardMovementPath, const MapPosition<Coordinate>& mapBounds);
 
 		friend constexpr WardOrientation operator&(const WardOrientation lWardOrientation, const WardOrientation rWardOrientation)
 		{
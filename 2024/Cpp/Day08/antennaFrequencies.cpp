@@ -1,5 +1,6 @@
 #include "antennaFrequencies.hpp"
 
+#include <cstdint>
 #include <fstream>
 #include <sstream>
 
@@ -32,38 +33,47 @@ std::optional<std::size_t> AntennaFrequencies::determineNumberOfUniqueAntiNodesW
 // START OF NON-PUBLIC FUNCTIONALITY
 std::optional<std::size_t> AntennaFrequencies::determineNumberOfUniqueAntiNodesFromStream(std::istream& inputStream, bool shouldConsiderResonantHarmonics)
 {
-	const std::optional<AntennaFieldData> antennaFieldData = processAntennaFieldData(inputStream);
+	return utils::processAsciiMapUsingNarrowestCoordinateType(inputStream, [shouldConsiderResonantHarmonics](std::istream& stream, auto coordinateTypeTag, bool& exceededCoordinateRange)
+	{
+		return determineNumberOfUniqueAntiNodesFromStream<decltype(coordinateTypeTag)>(stream, shouldConsiderResonantHarmonics, exceededCoordinateRange);
+	});
+}
+
+template <typename Coordinate>
+std::optional<std::size_t> AntennaFrequencies::determineNumberOfUniqueAntiNodesFromStream(std::istream& inputStream, bool shouldConsiderResonantHarmonics, bool& exceededCoordinateRange)
+{
+	const std::optional<AntennaFieldData<Coordinate>> antennaFieldData = processAntennaFieldData<Coordinate>(inputStream, exceededCoordinateRange);
 	if (!antennaFieldData)
 		return std::nullopt;
 
 	if (!antennaFieldData->mapDimensions.row || !antennaFieldData->mapDimensions.col)
 		return 0;
 
-	const AntennaPerTypeLookup& antennaPerTypeLookup = antennaFieldData->antennas;
-	const utils::AsciiMapPosition& mapDimensions = antennaFieldData->mapDimensions;
+	const AntennaPerTypeLookup<Coordinate>& antennaPerTypeLookup = antennaFieldData->antennas;
+	const MapPosition<Coordinate>& mapDimensions = antennaFieldData->mapDimensions;
 
-	RecordedAntiNodePositions uniqueAntiNodePositions;
+	RecordedAntiNodePositions<Coordinate> uniqueAntiNodePositions;
 	for (const auto& [antennaType, antennaPositions] : antennaPerTypeLookup)
 	{
 		if (antennaPositions.size() < 2)
 			continue;
 
 		const bool doesAntennaTypeAllowForResonantHarmonics = shouldConsiderResonantHarmonics ? antennaPositions.size() > 2 : false;
-		std::unordered_set<utils::AsciiMapPosition, utils::AsciiMapPosition> antennasUsedAsSources(antennaPositions.size());
+		std::unordered_set<MapPosition<Coordinate>, MapPosition<Coordinate>> antennasUsedAsSources(antennaPositions.size());
 		for (std::size_t sourceIndex = 0; sourceIndex < antennaPositions.size(); ++sourceIndex)
 		{
 			for (std::size_t destinationIndex = 0; destinationIndex < antennaPositions.size(); ++destinationIndex)
 			{
-				const utils::AsciiMapPosition& sourceAntenna = antennaPositions.at(sourceIndex);
+				const MapPosition<Coordinate>& sourceAntenna = antennaPositions.at(sourceIndex);
 				if (antennasUsedAsSources.count(sourceAntenna) || sourceIndex == destinationIndex)
 					continue;
 
-				utils::AsciiMapPosition currSourceAntennna = sourceAntenna;
+				MapPosition<Coordinate> currSourceAntennna = sourceAntenna;
 				if (doesAntennaTypeAllowForResonantHarmonics)
 					uniqueAntiNodePositions.emplace(sourceAntenna);
 
-				utils::AsciiMapPosition nextDestinationAntenna = antennaPositions.at(destinationIndex);
-				std::optional<utils::AsciiMapPosition> antiNodePosition = determineAntiNodePosition(sourceAntenna, nextDestinationAntenna, mapDimensions, doesAntennaTypeAllowForResonantHarmonics);
+				MapPosition<Coordinate> nextDestinationAntenna = antennaPositions.at(destinationIndex);
+				std::optional<MapPosition<Coordinate>> antiNodePosition = determineAntiNodePosition(sourceAntenna, nextDestinationAntenna, mapDimensions, doesAntennaTypeAllowForResonantHarmonics);
 
 				while (antiNodePosition.has_value())
 				{
@@ -80,37 +90,46 @@ std::optional<std::size_t> AntennaFrequencies::determineNumberOfUniqueAntiNodesF
 	return uniqueAntiNodePositions.size();
 }
 
-std::optional<AntennaFrequencies::AntennaFieldData> AntennaFrequencies::processAntennaFieldData(std::istream& inputStream)
+template <typename Coordinate>
+std::optional<AntennaFrequencies::AntennaFieldData<Coordinate>> AntennaFrequencies::processAntennaFieldData(std::istream& inputStream, bool& exceededCoordinateRange)
 {
-	utils::AsciiMapProcessor<char> asciiMapProcessor;
-	utils::AsciiMapProcessor<char>::AsciiMapProcessingResult lastProcessedMapEntry;
-	AntennaPerTypeLookup antennaLookup;
+	using AntennaFieldProcessor = utils::AsciiMapProcessor<char, Coordinate>;
+	AntennaFieldProcessor asciiMapProcessor;
+	AntennaPerTypeLookup<Coordinate> antennaLookup;
+	std::vector<utils::AsciiMapElement<char, Coordinate>> antennasOfRow;
 
-	while (asciiMapProcessor.findNextElement(inputStream, nullptr, lastProcessedMapEntry, true) && lastProcessedMapEntry.data.has_value())
+	auto rowProcessingStopageReason = AntennaFieldProcessor::StopageReason::Newline;
+	while (rowProcessingStopageReason == AntennaFieldProcessor::StopageReason::Newline)
 	{
-		const char mapEntryIdentifier = lastProcessedMapEntry.data.value();
-		if (!std::isalnum(mapEntryIdentifier))
-			return std::nullopt;
-
-		if (!antennaLookup.count(mapEntryIdentifier))
-			antennaLookup.emplace(mapEntryIdentifier, std::vector<utils::AsciiMapPosition>());
+		antennasOfRow.clear();
+		rowProcessingStopageReason = asciiMapProcessor.appendElementsOfNextRow(inputStream, nullptr, antennasOfRow);
+		for (const auto& [antennaPosition, mapEntryIdentifier] : antennasOfRow)
+		{
+			if (!std::isalnum(mapEntryIdentifier))
+				return std::nullopt;
 
-		antennaLookup[mapEntryIdentifier].emplace_back(lastProcessedMapEntry.position);
+			antennaLookup[mapEntryIdentifier].emplace_back(antennaPosition);
+		}
 	}
 
-	if (lastProcessedMapEntry.streamProcessingStopageReason != utils::AsciiMapProcessor<char>::StopageReason::EndOfFile)
+	exceededCoordinateRange = rowProcessingStopageReason == AntennaFieldProcessor::StopageReason::CoordinateOverflow;
+	if (rowProcessingStopageReason != AntennaFieldProcessor::StopageReason::EndOfFile)
 		return std::nullopt;
 
-	return AntennaFieldData(asciiMapProcessor.determineMapBounderies(), std::move(antennaLookup));
+	return AntennaFieldData<Coordinate>(asciiMapProcessor.determineMapBounderies(), std::move(antennaLookup));
 }
 
-std::optional<utils::AsciiMapPosition> AntennaFrequencies::determineAntiNodePosition(const utils::AsciiMapPosition& sourceAntennaPosition, const utils::AsciiMapPosition& destinationAntennaPosition, const utils::AsciiMapPosition& mapDimensions, bool isDestinationAllowedAsAntiNode)
+template <typename Coordinate>
+std::optional<AntennaFrequencies::MapPosition<Coordinate>> AntennaFrequencies::determineAntiNodePosition(const MapPosition<Coordinate>& sourceAntennaPosition, const MapPosition<Coordinate>& destinationAntennaPosition, const MapPosition<Coordinate>& mapDimensions, bool isDestinationAllowedAsAntiNode)
 {
-	const utils::AsciiMapPosition antiNodePosition = sourceAntennaPosition - (destinationAntennaPosition - sourceAntennaPosition);
+	// The anti node can be located up to twice the map dimensions away from the origin and is thus calculated using a wider type than the coordinate type of the map positions.
+	const std::int64_t antiNodeRow = 2 * static_cast<std::int64_t>(sourceAntennaPosition.row) - destinationAntennaPosition.row;
+	const std::int64_t antiNodeCol = 2 * static_cast<std::int64_t>(sourceAntennaPosition.col) - destinationAntennaPosition.col;
+	if (antiNodeRow < 0 || antiNodeRow >= mapDimensions.row || antiNodeCol < 0 || antiNodeCol >= mapDimensions.col)
+		return std::nullopt;
 
-	return (antiNodePosition == destinationAntennaPosition ? isDestinationAllowedAsAntiNode : true)
-		&& antiNodePosition.row >= 0 && antiNodePosition.row < mapDimensions.row
-		&& antiNodePosition.col >= 0 && antiNodePosition.col < mapDimensions.col
-		? std::make_optional(antiNodePosition)
-		: std::nullopt;
+	const MapPosition<Coordinate> antiNodePosition(static_cast<Coordinate>(antiNodeRow), static_cast<Coordinate>(antiNodeCol));
+	return antiNodePosition == destinationAntennaPosition && !isDestinationAllowedAsAntiNode
+		? std::nullopt
+		: std::make_optional(antiNodePosition);
 }
\ No newline at end of file
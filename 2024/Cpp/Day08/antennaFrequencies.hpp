@@ -3,7 +3,9 @@
 
 #include <istream>
 #include <optional>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "../utils/asciiMapProcessor.hpp"
 
@@ -18,20 +20,31 @@ namespace Day08 {
 
 	protected:
 		using AntennaType = char;
-		using AntennaPerTypeLookup = std::unordered_map<AntennaType, std::vector<utils::AsciiMapPosition>>;
-		using RecordedAntiNodePositions = std::unordered_set<utils::AsciiMapPosition, utils::AsciiMapPosition>;
+		// The coordinate type of the map positions is chosen based on the dimensions of the processed antenna field
+		template <typename Coordinate>
+		using MapPosition = utils::BasicAsciiMapPosition<Coordinate>;
+		template <typename Coordinate>
+		using AntennaPerTypeLookup = std::unordered_map<AntennaType, std::vector<MapPosition<Coordinate>>>;
+		template <typename Coordinate>
+		using RecordedAntiNodePositions = std::unordered_set<MapPosition<Coordinate>, MapPosition<Coordinate>>;
+
+		template <typename Coordinate>
 		struct AntennaFieldData
 		{
-			utils::AsciiMapPosition mapDimensions;
-			AntennaPerTypeLookup antennas;
+			MapPosition<Coordinate> mapDimensions;
+			AntennaPerTypeLookup<Coordinate> antennas;
 
-			AntennaFieldData(utils::AsciiMapPosition mapDimensions, AntennaPerTypeLookup&& antennas):
+			AntennaFieldData(MapPosition<Coordinate> mapDimensions, AntennaPerTypeLookup<Coordinate>&& antennas):
 				mapDimensions(mapDimensions), antennas(std::move(antennas)) {}
 		};
 
 		[[nodiscard]] static std::optional<std::size_t> determineNumberOfUniqueAntiNodesFromStream(std::istream& inputStream, bool shouldConsiderResonantHarmonics);
-		[[nodiscard]] static std::optional<AntennaFieldData> processAntennaFieldData(std::istream& inputStream);
-		[[nodiscard]] static std::optional<utils::AsciiMapPosition> determineAntiNodePosition(const utils::AsciiMapPosition& sourceAntennaPosition, const utils::AsciiMapPosition& destinationAntennaPosition, const utils::AsciiMapPosition& mapDimensions, bool isDestinationAllowedAsAntiNode);
+		template <typename Coordinate>
+		[[nodiscard]] static std::optional<std::size_t> determineNumberOfUniqueAntiNodesFromStream(std::istream& inputStream, bool shouldConsiderResonantHarmonics, bool& exceededCoordinateRange);
+		template <typename Coordinate>
+		[[nodiscard]] static std::optional<AntennaFieldData<Coordinate>> processAntennaFieldData(std::istream& inputStream, bool& exceededCoordinateRange);
+		template <typename Coordinate>
+		[[nodiscard]] static std::optional<MapPosition<Coordinate>> determineAntiNodePosition(const MapPosition<Coordinate>& sourceAntennaPosition, const MapPosition<Coordinate>& destinationAntennaPosition, const MapPosition<Coordinate>& mapDimensions, bool isDestinationAllowedAsAntiNode);
 	};
 }
 
@@ -0,0 +1,264 @@
+#include "../utils/asciiMapProcessor.hpp"
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <optional>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace utils;
+
+class AsciiMapProcessorTests : public ::testing::Test {
+public:
+	struct ProcessedAsciiMap
+	{
+		std::size_t numBytesOfCoordinateType;
+		AsciiMapPosition mapDimensions;
+		std::vector<AsciiMapElement<char>> elements;
+	};
+
+	/// Stream buffer over a fixed string that does not support seeking, i.e. tellg() of a stream using it reports a failure.
+	class NonSeekableStreamBuffer : public std::streambuf
+	{
+	public:
+		explicit NonSeekableStreamBuffer(std::string content)
+			: content(std::move(content))
+		{
+			setg(this->content.data(), this->content.data(), this->content.data() + this->content.size());
+		}
+
+	private:
+		std::string content;
+	};
+
+	template <typename Coordinate>
+	static std::optional<ProcessedAsciiMap> processAsciiMapFromStream(std::istream& inputStream, bool& exceededCoordinateRange)
+	{
+		AsciiMapProcessor<char, Coordinate> asciiMapProcessor;
+		std::vector<AsciiMapElement<char, Coordinate>> elements;
+
+		typename AsciiMapProcessor<char, Coordinate>::StopageReason stopageReason;
+		do
+		{
+			stopageReason = asciiMapProcessor.appendElementsOfNextRow(inputStream, nullptr, elements);
+		} while (stopageReason == AsciiMapProcessor<char, Coordinate>::StopageReason::Newline);
+
+		exceededCoordinateRange = stopageReason == AsciiMapProcessor<char, Coordinate>::StopageReason::CoordinateOverflow;
+		if (stopageReason != AsciiMapProcessor<char, Coordinate>::StopageReason::EndOfFile)
+			return std::nullopt;
+
+		const typename AsciiMapProcessor<char, Coordinate>::Position mapDimensions = asciiMapProcessor.determineMapBounderies();
+		ProcessedAsciiMap processedAsciiMap{ sizeof(Coordinate), AsciiMapPosition(mapDimensions.row, mapDimensions.col), {} };
+		for (const AsciiMapElement<char, Coordinate>& element : elements)
+			processedAsciiMap.elements.emplace_back(AsciiMapPosition(element.position.row, element.position.col), element.data);
+		return processedAsciiMap;
+	}
+
+	static std::optional<ProcessedAsciiMap> processAsciiMapUsingNarrowestCoordinateTypeFromStream(std::istream& inputStream)
+	{
+		return processAsciiMapUsingNarrowestCoordinateType(inputStream, [](std::istream& stream, auto coordinateTypeTag, bool& exceededCoordinateRange)
+		{
+			return processAsciiMapFromStream<decltype(coordinateTypeTag)>(stream, exceededCoordinateRange);
+		});
+	}
+
+	/// Map whose single row is wider than the values representable by std::int16_t with elements close to both of its ends
+	static std::string generateAsciiMapWiderThanInt16Range()
+	{
+		constexpr std::size_t numCols = static_cast<std::size_t>(INT16_MAX) + 100;
+		std::string asciiMap(numCols, '.');
+		asciiMap[1] = 'a';
+		asciiMap[INT16_MAX - 1] = 'b';
+		asciiMap[numCols - 1] = 'c';
+		return asciiMap + "\n.d" + std::string(numCols - 2, '.');
+	}
+
+	static void assertProcessedAsciiMapsAreEqual(const ProcessedAsciiMap& expectedAsciiMap, const ProcessedAsciiMap& actualAsciiMap)
+	{
+		ASSERT_EQ(expectedAsciiMap.mapDimensions, actualAsciiMap.mapDimensions);
+		ASSERT_EQ(expectedAsciiMap.elements.size(), actualAsciiMap.elements.size());
+		for (std::size_t i = 0; i < expectedAsciiMap.elements.size(); ++i)
+		{
+			ASSERT_EQ(expectedAsciiMap.elements[i].position, actualAsciiMap.elements[i].position) << "Position mismatch of element " << i;
+			ASSERT_EQ(expectedAsciiMap.elements[i].data, actualAsciiMap.elements[i].data) << "Data mismatch of element " << i;
+		}
+	}
+};
+
+TEST_F(AsciiMapProcessorTests, NarrowestCoordinateTypeUsedForSmallMap)
+{
+	std::istringstream inputStream("a..\n.b.\n..c");
+	const std::optional<ProcessedAsciiMap> processedAsciiMap = AsciiMapProcessorTests::processAsciiMapUsingNarrowestCoordinateTypeFromStream(inputStream);
+	ASSERT_TRUE(processedAsciiMap.has_value());
+	ASSERT_EQ(sizeof(std::int16_t), processedAsciiMap->numBytesOfCoordinateType);
+	ASSERT_EQ(AsciiMapPosition(3, 3), processedAsciiMap->mapDimensions);
+	ASSERT_EQ(3, processedAsciiMap->elements.size());
+}
+
+TEST_F(AsciiMapProcessorTests, WiderCoordinateTypeUsedForMapWiderThanInt16Range)
+{
+	const std::string asciiMap = AsciiMapProcessorTests::generateAsciiMapWiderThanInt16Range();
+
+	std::istringstream referenceInputStream(asciiMap);
+	bool exceededCoordinateRange = false;
+	const std::optional<ProcessedAsciiMap> expectedAsciiMap = AsciiMapProcessorTests::processAsciiMapFromStream<std::int64_t>(referenceInputStream, exceededCoordinateRange);
+	ASSERT_TRUE(expectedAsciiMap.has_value());
+	ASSERT_FALSE(exceededCoordinateRange);
+	ASSERT_EQ(4, expectedAsciiMap->elements.size());
+
+	// The stream needs to be rewound to the position at which the processing started and not to its beginning
+	std::istringstream inputStream("header\n" + asciiMap);
+	std::string header;
+	ASSERT_TRUE(std::getline(inputStream, header));
+
+	const std::optional<ProcessedAsciiMap> processedAsciiMap = AsciiMapProcessorTests::processAsciiMapUsingNarrowestCoordinateTypeFromStream(inputStream);
+	ASSERT_TRUE(processedAsciiMap.has_value());
+	ASSERT_EQ(sizeof(std::int32_t), processedAsciiMap->numBytesOfCoordinateType);
+	ASSERT_NO_FATAL_FAILURE(AsciiMapProcessorTests::assertProcessedAsciiMapsAreEqual(*expectedAsciiMap, *processedAsciiMap));
+}
+
+TEST_F(AsciiMapProcessorTests, WidestCoordinateTypeUsedForNonSeekableStream)
+{
+	const std::string asciiMap = AsciiMapProcessorTests::generateAsciiMapWiderThanInt16Range();
+
+	std::istringstream referenceInputStream(asciiMap);
+	bool exceededCoordinateRange = false;
+	const std::optional<ProcessedAsciiMap> expectedAsciiMap = AsciiMapProcessorTests::processAsciiMapFromStream<std::int64_t>(referenceInputStream, exceededCoordinateRange);
+	ASSERT_TRUE(expectedAsciiMap.has_value());
+
+	NonSeekableStreamBuffer nonSeekableStreamBuffer(asciiMap);
+	std::istream inputStream(&nonSeekableStreamBuffer);
+	ASSERT_EQ(std::istream::pos_type(-1), inputStream.tellg());
+	inputStream.clear();
+
+	const std::optional<ProcessedAsciiMap> processedAsciiMap = AsciiMapProcessorTests::processAsciiMapUsingNarrowestCoordinateTypeFromStream(inputStream);
+	ASSERT_TRUE(processedAsciiMap.has_value());
+	ASSERT_EQ(sizeof(std::int64_t), processedAsciiMap->numBytesOfCoordinateType);
+	ASSERT_NO_FATAL_FAILURE(AsciiMapProcessorTests::assertProcessedAsciiMapsAreEqual(*expectedAsciiMap, *processedAsciiMap));
+}
+
+TEST_F(AsciiMapProcessorTests, RowsProcessedWithTheirIndices)
+{
+	std::istringstream inputStream("ab\ncd\nef");
+	AsciiMapProcessor<char> asciiMapProcessor;
+	std::vector<std::pair<std::string, long>> processedRows;
+	const auto stopageReason = asciiMapProcessor.processRows(inputStream, [&processedRows](std::string_view row, long rowIndex)
+	{
+		processedRows.emplace_back(std::string(row), rowIndex);
+		return true;
+	});
+
+	ASSERT_EQ(AsciiMapProcessor<char>::StopageReason::EndOfFile, stopageReason);
+	const std::vector<std::pair<std::string, long>> expectedRows = { { "ab", 0 }, { "cd", 1 }, { "ef", 2 } };
+	ASSERT_EQ(expectedRows, processedRows);
+	ASSERT_EQ(AsciiMapPosition(3, 2), asciiMapProcessor.determineMapBounderies());
+}
+
+TEST_F(AsciiMapProcessorTests, EmptyRowFollowingTrailingNewlineIsProcessed)
+{
+	std::istringstream inputStream("ab\ncd\n");
+	AsciiMapProcessor<char> asciiMapProcessor;
+	std::vector<std::pair<std::string, long>> processedRows;
+	const auto stopageReason = asciiMapProcessor.processRows(inputStream, [&processedRows](std::string_view row, long rowIndex)
+	{
+		processedRows.emplace_back(std::string(row), rowIndex);
+		return true;
+	});
+
+	ASSERT_EQ(AsciiMapProcessor<char>::StopageReason::EndOfFile, stopageReason);
+	const std::vector<std::pair<std::string, long>> expectedRows = { { "ab", 0 }, { "cd", 1 }, { "", 2 } };
+	ASSERT_EQ(expectedRows, processedRows);
+}
+
+TEST_F(AsciiMapProcessorTests, RowProcessingStoppedByRowProcessor)
+{
+	std::istringstream inputStream("ab\ncd\nef");
+	AsciiMapProcessor<char> asciiMapProcessor;
+	std::vector<long> processedRowIndices;
+	const auto stopageReason = asciiMapProcessor.processRows(inputStream, [&processedRowIndices](std::string_view row, long rowIndex)
+	{
+		processedRowIndices.emplace_back(rowIndex);
+		return row != "cd";
+	});
+
+	ASSERT_EQ(AsciiMapProcessor<char>::StopageReason::ParsingError, stopageReason);
+	ASSERT_EQ(std::vector<long>({ 0, 1 }), processedRowIndices);
+}
+
+TEST_F(AsciiMapProcessorTests, ElementsOfRowsAppended)
+{
+	std::istringstream inputStream("a..b\n....\n.c.d");
+	AsciiMapProcessor<char> asciiMapProcessor;
+	std::vector<AsciiMapElement<char>> elements;
+
+	ASSERT_EQ(AsciiMapProcessor<char>::StopageReason::Newline, asciiMapProcessor.appendElementsOfNextRow(inputStream, nullptr, elements));
+	ASSERT_EQ(2, elements.size());
+	ASSERT_EQ(AsciiMapProcessor<char>::StopageReason::Newline, asciiMapProcessor.appendElementsOfNextRow(inputStream, nullptr, elements));
+	ASSERT_EQ(2, elements.size());
+	ASSERT_EQ(AsciiMapProcessor<char>::StopageReason::EndOfFile, asciiMapProcessor.appendElementsOfNextRow(inputStream, nullptr, elements));
+
+	const std::vector<AsciiMapElement<char>> expectedElements = { AsciiMapElement<char>(AsciiMapPosition(0, 0), 'a'), AsciiMapElement<char>(AsciiMapPosition(0, 3), 'b'), AsciiMapElement<char>(AsciiMapPosition(2, 1), 'c'), AsciiMapElement<char>(AsciiMapPosition(2, 3), 'd') };
+	ASSERT_EQ(expectedElements.size(), elements.size());
+	for (std::size_t i = 0; i < expectedElements.size(); ++i)
+	{
+		ASSERT_EQ(expectedElements[i].position, elements[i].position);
+		ASSERT_EQ(expectedElements[i].data, elements[i].data);
+	}
+	ASSERT_EQ(AsciiMapPosition(3, 4), asciiMapProcessor.determineMapBounderies());
+}
+
+TEST_F(AsciiMapProcessorTests, ElementsOfRowsMappedToEnum)
+{
+	enum class Tile { Wall, Door };
+	using TileMapProcessor = AsciiMapProcessor<Tile>;
+
+	std::istringstream inputStream("#.D\n.x#");
+	TileMapProcessor asciiMapProcessor;
+	std::vector<AsciiMapElement<Tile>> elements;
+
+	const TileMapProcessor::CharacterToEnumMapping characterToTileMapping = { { '#', Tile::Wall }, { 'D', Tile::Door } };
+	ASSERT_EQ(TileMapProcessor::StopageReason::Newline, asciiMapProcessor.appendElementsOfNextRow(inputStream, &characterToTileMapping, elements));
+	ASSERT_EQ(TileMapProcessor::StopageReason::EndOfFile, asciiMapProcessor.appendElementsOfNextRow(inputStream, &characterToTileMapping, elements));
+
+	ASSERT_EQ(3, elements.size());
+	ASSERT_EQ(AsciiMapPosition(0, 0), elements[0].position);
+	ASSERT_EQ(Tile::Wall, elements[0].data);
+	ASSERT_EQ(AsciiMapPosition(0, 2), elements[1].position);
+	ASSERT_EQ(Tile::Door, elements[1].data);
+	ASSERT_EQ(AsciiMapPosition(1, 2), elements[2].position);
+	ASSERT_EQ(Tile::Wall, elements[2].data);
+}
+
+TEST_F(AsciiMapProcessorTests, ModifiedEnumMappingUsedForFollowingRows)
+{
+	enum class Tile { Wall, Door };
+	using TileMapProcessor = AsciiMapProcessor<Tile>;
+
+	std::istringstream inputStream("#D\n#D");
+	TileMapProcessor asciiMapProcessor;
+	std::vector<AsciiMapElement<Tile>> elements;
+
+	TileMapProcessor::CharacterToEnumMapping characterToTileMapping = { { '#', Tile::Wall } };
+	ASSERT_EQ(TileMapProcessor::StopageReason::Newline, asciiMapProcessor.appendElementsOfNextRow(inputStream, &characterToTileMapping, elements));
+	ASSERT_EQ(1, elements.size());
+
+	characterToTileMapping = { { 'D', Tile::Door } };
+	ASSERT_EQ(TileMapProcessor::StopageReason::EndOfFile, asciiMapProcessor.appendElementsOfNextRow(inputStream, &characterToTileMapping, elements));
+	ASSERT_EQ(2, elements.size());
+	ASSERT_EQ(AsciiMapPosition(1, 1), elements[1].position);
+	ASSERT_EQ(Tile::Door, elements[1].data);
+}
+
+TEST_F(AsciiMapProcessorTests, MissingEnumMappingCausesParsingError)
+{
+	enum class Tile { Wall };
+	std::istringstream inputStream("#.");
+	AsciiMapProcessor<Tile> asciiMapProcessor;
+	std::vector<AsciiMapElement<Tile>> elements;
+	ASSERT_EQ(AsciiMapProcessor<Tile>::StopageReason::ParsingError, asciiMapProcessor.appendElementsOfNextRow(inputStream, nullptr, elements));
+	ASSERT_TRUE(elements.empty());
+}
@@ -0,0 +1,191 @@
+#include "../utils/asciiMapStorage.hpp"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+using namespace utils;
+
+class AsciiMapStorageTests : public ::testing::Test {
+public:
+	using Position = AsciiMapPosition;
+	using Element = AsciiMapElement<char>;
+
+	/// Every position of the map is queried and the elements reported by the iteration are compared to the expected ones (which need to be in row-major order).
+	template <typename Storage>
+	static void assertStorageContainsExactlyElements(const Storage& storage, const Position& mapDimensions, const std::vector<Element>& expectedElements)
+	{
+		for (long row = 0; row < mapDimensions.row; ++row)
+		{
+			for (long col = 0; col < mapDimensions.col; ++col)
+			{
+				const Position position(row, col);
+				const auto expectedElement = std::find_if(expectedElements.cbegin(), expectedElements.cend(), [&position](const Element& element) { return element.position == position; });
+				const std::optional<char> expectedData = expectedElement != expectedElements.cend() ? std::make_optional(expectedElement->data) : std::nullopt;
+
+				ASSERT_EQ(expectedData, storage.getElementAt(position)) << "Element mismatch at row " << row << " and col " << col;
+				ASSERT_EQ(expectedData.has_value(), storage.containsElementAt(position)) << "Containment mismatch at row " << row << " and col " << col;
+			}
+		}
+
+		std::vector<Element> iteratedElements;
+		storage.forEachElement([&iteratedElements](const Position& position, char data) { iteratedElements.emplace_back(position, data); });
+		ASSERT_EQ(expectedElements.size(), iteratedElements.size());
+		for (std::size_t i = 0; i < expectedElements.size(); ++i)
+		{
+			ASSERT_EQ(expectedElements[i].position, iteratedElements[i].position) << "Iteration order mismatch at element " << i;
+			ASSERT_EQ(expectedElements[i].data, iteratedElements[i].data) << "Iterated data mismatch at element " << i;
+		}
+		ASSERT_EQ(expectedElements.size(), storage.getNumElements());
+	}
+
+	static void assertPositionsOutsideOfMapAreEmpty(const AsciiMapStorage<char>& storage)
+	{
+		const Position mapDimensions = storage.determineMapBounderies();
+		for (const Position& position : { Position(-1, 0), Position(0, -1), Position(-1, -1), Position(mapDimensions.row, 0), Position(0, mapDimensions.col), Position(mapDimensions.row, mapDimensions.col) })
+		{
+			ASSERT_FALSE(storage.getElementAt(position).has_value()) << "Element found at row " << position.row << " and col " << position.col;
+			ASSERT_FALSE(storage.containsElementAt(position)) << "Element contained at row " << position.row << " and col " << position.col;
+		}
+	}
+
+	/// Rows with full width runs, empty rows, single elements and runs of differing values directly following each other.
+	static std::vector<Element> generateElementsWithRunsAndEmptyRows(const Position& mapDimensions)
+	{
+		std::vector<Element> elements;
+		for (long col = 0; col < mapDimensions.col; ++col)
+			elements.emplace_back(Position(0, col), 'a');
+		for (const long col : { 0L, 2L, 3L, mapDimensions.col - 1 })
+			elements.emplace_back(Position(2, col), col == 3 ? 'c' : 'b');
+		for (long col = 1; col < mapDimensions.col - 1; ++col)
+			elements.emplace_back(Position(4, col), col < mapDimensions.col / 2 ? 'd' : 'e');
+		for (long col = 0; col < mapDimensions.col; ++col)
+			elements.emplace_back(Position(mapDimensions.row - 1, col), 'f');
+		return elements;
+	}
+
+	static AsciiMapStorageKind determineKindWithSmallestFootprint(const Position& mapDimensions, const std::vector<Element>& elements)
+	{
+		const std::size_t denseFootprint = DenseAsciiMapStorage<char>::estimateMemoryFootprintInBytes(mapDimensions);
+		const std::size_t runLengthEncodedFootprint = RunLengthEncodedAsciiMapStorage<char>::estimateMemoryFootprintInBytes(mapDimensions, elements);
+		const std::size_t sparseFootprint = SparseAsciiMapStorage<char>::estimateMemoryFootprintInBytes(mapDimensions, elements);
+		if (denseFootprint <= runLengthEncodedFootprint && denseFootprint <= sparseFootprint)
+			return AsciiMapStorageKind::Dense;
+		return runLengthEncodedFootprint < sparseFootprint ? AsciiMapStorageKind::RunLengthEncoded : AsciiMapStorageKind::SparseCoordinateList;
+	}
+};
+
+TEST_F(AsciiMapStorageTests, DenseStorageWithRunsAndEmptyRows)
+{
+	const Position mapDimensions(7, 9);
+	const std::vector<Element> elements = AsciiMapStorageTests::generateElementsWithRunsAndEmptyRows(mapDimensions);
+	ASSERT_NO_FATAL_FAILURE(AsciiMapStorageTests::assertStorageContainsExactlyElements(DenseAsciiMapStorage<char>(mapDimensions, elements), mapDimensions, elements));
+}
+
+TEST_F(AsciiMapStorageTests, RunLengthEncodedStorageWithRunsAndEmptyRows)
+{
+	const Position mapDimensions(7, 9);
+	const std::vector<Element> elements = AsciiMapStorageTests::generateElementsWithRunsAndEmptyRows(mapDimensions);
+	ASSERT_NO_FATAL_FAILURE(AsciiMapStorageTests::assertStorageContainsExactlyElements(RunLengthEncodedAsciiMapStorage<char>(mapDimensions, elements), mapDimensions, elements));
+}
+
+TEST_F(AsciiMapStorageTests, SparseStorageWithRunsAndEmptyRows)
+{
+	const Position mapDimensions(7, 9);
+	const std::vector<Element> elements = AsciiMapStorageTests::generateElementsWithRunsAndEmptyRows(mapDimensions);
+	ASSERT_NO_FATAL_FAILURE(AsciiMapStorageTests::assertStorageContainsExactlyElements(SparseAsciiMapStorage<char>(mapDimensions, elements), mapDimensions, elements));
+}
+
+TEST_F(AsciiMapStorageTests, StoragesWithoutElements)
+{
+	const Position mapDimensions(3, 4);
+	const std::vector<Element> elements;
+	ASSERT_NO_FATAL_FAILURE(AsciiMapStorageTests::assertStorageContainsExactlyElements(DenseAsciiMapStorage<char>(mapDimensions, elements), mapDimensions, elements));
+	ASSERT_NO_FATAL_FAILURE(AsciiMapStorageTests::assertStorageContainsExactlyElements(RunLengthEncodedAsciiMapStorage<char>(mapDimensions, elements), mapDimensions, elements));
+	ASSERT_NO_FATAL_FAILURE(AsciiMapStorageTests::assertStorageContainsExactlyElements(SparseAsciiMapStorage<char>(mapDimensions, elements), mapDimensions, elements));
+}
+
+TEST_F(AsciiMapStorageTests, DenseStorageChosenForSmallMap)
+{
+	const Position mapDimensions(7, 9);
+	const std::vector<Element> elements = AsciiMapStorageTests::generateElementsWithRunsAndEmptyRows(mapDimensions);
+	const AsciiMapStorage<char> storage = AsciiMapStorage<char>::fromElements(mapDimensions, std::vector<Element>(elements));
+	ASSERT_EQ(AsciiMapStorageKind::Dense, storage.getStorageKind());
+	ASSERT_NO_FATAL_FAILURE(AsciiMapStorageTests::assertStorageContainsExactlyElements(storage, mapDimensions, elements));
+	ASSERT_NO_FATAL_FAILURE(AsciiMapStorageTests::assertPositionsOutsideOfMapAreEmpty(storage));
+}
+
+TEST_F(AsciiMapStorageTests, RunLengthEncodedStorageChosenForRowsSpanningRuns)
+{
+	const Position mapDimensions(7, 4000);
+	const std::vector<Element> elements = AsciiMapStorageTests::generateElementsWithRunsAndEmptyRows(mapDimensions);
+	const AsciiMapStorage<char> storage = AsciiMapStorage<char>::fromElements(mapDimensions, std::vector<Element>(elements));
+	ASSERT_EQ(AsciiMapStorageKind::RunLengthEncoded, storage.getStorageKind());
+	ASSERT_NO_FATAL_FAILURE(AsciiMapStorageTests::assertPositionsOutsideOfMapAreEmpty(storage));
+	for (const Element& element : elements)
+		ASSERT_EQ(element.data, storage.getElementAt(element.position));
+	ASSERT_FALSE(storage.containsElementAt(Position(1, 0)));
+	ASSERT_FALSE(storage.containsElementAt(Position(2, 1)));
+	ASSERT_EQ(elements.size(), storage.getNumElements());
+}
+
+TEST_F(AsciiMapStorageTests, SparseStorageChosenForScatteredElements)
+{
+	const Position mapDimensions(1000, 1000);
+	const std::vector<Element> elements = { Element(Position(0, 999), 'a'), Element(Position(500, 3), 'b'), Element(Position(500, 4), 'c'), Element(Position(999, 0), 'd') };
+	const AsciiMapStorage<char> storage = AsciiMapStorage<char>::fromElements(mapDimensions, std::vector<Element>(elements));
+	ASSERT_EQ(AsciiMapStorageKind::SparseCoordinateList, storage.getStorageKind());
+	ASSERT_NO_FATAL_FAILURE(AsciiMapStorageTests::assertPositionsOutsideOfMapAreEmpty(storage));
+	for (const Element& element : elements)
+		ASSERT_EQ(element.data, storage.getElementAt(element.position));
+	ASSERT_FALSE(storage.containsElementAt(Position(500, 5)));
+	ASSERT_FALSE(storage.containsElementAt(Position(1, 999)));
+
+	std::vector<Element> iteratedElements;
+	storage.forEachElement([&iteratedElements](const Position& position, char data) { iteratedElements.emplace_back(position, data); });
+	ASSERT_EQ(elements.size(), iteratedElements.size());
+	for (std::size_t i = 0; i < elements.size(); ++i)
+		ASSERT_EQ(elements[i].position, iteratedElements[i].position);
+}
+
+TEST_F(AsciiMapStorageTests, ElementsOutsideOfMapAndUnorderedElementsAreHandled)
+{
+	const Position mapDimensions(3, 3);
+	std::vector<Element> elements = { Element(Position(2, 2), 'c'), Element(Position(-1, 0), 'x'), Element(Position(0, 1), 'a'), Element(Position(3, 0), 'x'), Element(Position(1, 0), 'b'), Element(Position(0, 3), 'x') };
+	const AsciiMapStorage<char> storage = AsciiMapStorage<char>::fromElements(mapDimensions, std::move(elements));
+	ASSERT_NO_FATAL_FAILURE(AsciiMapStorageTests::assertStorageContainsExactlyElements(storage, mapDimensions, { Element(Position(0, 1), 'a'), Element(Position(1, 0), 'b'), Element(Position(2, 2), 'c') }));
+	ASSERT_NO_FATAL_FAILURE(AsciiMapStorageTests::assertPositionsOutsideOfMapAreEmpty(storage));
+}
+
+TEST_F(AsciiMapStorageTests, DenseStorageChosenOnceSparseStorageBecomesLarger)
+{
+	// A single row of 64 columns requires 72 bytes in the dense storage while every non-adjacent element requires 9 bytes (plus 16 bytes for the row offsets) in the sparse one
+	const Position mapDimensions(1, 64);
+	std::vector<Element> elements;
+	for (long numElements = 1; numElements <= 12; ++numElements)
+	{
+		elements.emplace_back(Position(0, 2 * (numElements - 1)), static_cast<char>('a' + numElements));
+		const AsciiMapStorage<char> storage = AsciiMapStorage<char>::fromElements(mapDimensions, std::vector<Element>(elements));
+		ASSERT_EQ(AsciiMapStorageTests::determineKindWithSmallestFootprint(mapDimensions, elements), storage.getStorageKind()) << "Unexpected storage for " << numElements << " elements";
+		ASSERT_EQ(numElements <= 6 ? AsciiMapStorageKind::SparseCoordinateList : AsciiMapStorageKind::Dense, storage.getStorageKind()) << "Unexpected storage for " << numElements << " elements";
+		ASSERT_NO_FATAL_FAILURE(AsciiMapStorageTests::assertStorageContainsExactlyElements(storage, mapDimensions, elements));
+	}
+}
+
+TEST_F(AsciiMapStorageTests, RunLengthEncodedStorageChosenOnceRunsAreLongEnough)
+{
+	// 100 adjacent elements require 916 bytes in the sparse storage while every run requires 24 bytes (plus 16 bytes for the row offsets) in the run-length encoded one
+	const Position mapDimensions(1, 1000);
+	for (long runLength = 1; runLength <= 5; ++runLength)
+	{
+		std::vector<Element> elements;
+		for (long col = 0; col < 100; ++col)
+			elements.emplace_back(Position(0, col), static_cast<char>('a' + (col / runLength) % 2));
+
+		const AsciiMapStorage<char> storage = AsciiMapStorage<char>::fromElements(mapDimensions, std::vector<Element>(elements));
+		ASSERT_EQ(AsciiMapStorageTests::determineKindWithSmallestFootprint(mapDimensions, elements), storage.getStorageKind()) << "Unexpected storage for runs of length " << runLength;
+		ASSERT_EQ(runLength >= 3 ? AsciiMapStorageKind::RunLengthEncoded : AsciiMapStorageKind::SparseCoordinateList, storage.getStorageKind()) << "Unexpected storage for runs of length " << runLength;
+		ASSERT_NO_FATAL_FAILURE(AsciiMapStorageTests::assertStorageContainsExactlyElements(storage, mapDimensions, elements));
+	}
+}
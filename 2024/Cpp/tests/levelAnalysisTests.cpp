@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 #include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
 
 using namespace Day02;
 
@@ -209,6 +212,266 @@ TEST_F(LevelAnalysisTests, FirstAndViolatingDuplicateLevelInDescendinglyCollecti
 }
 
 
+TEST_F(LevelAnalysisTests, ExampleReportsWithOneFaultyLevelAllowed) {
+	const LevelAnalysis::LevelReportCollection collection{
+		{7,6,4,2,1},
+		{1,2,7,8,9},
+		{9,7,6,2,1},
+		{1,3,2,4,5},
+		{8,6,4,4,1},
+		{1,3,6,7,9}
+	};
+	ASSERT_NO_FATAL_FAILURE(assertNumberOfReportsMatches(collection, 2));
+	ASSERT_NO_FATAL_FAILURE(assertNumberOfReportsMatchesWithOneFaultyLevelAllowed(collection, 4));
+}
+
+TEST_F(LevelAnalysisTests, RemovalOfFirstOrLastLevelWithOneFaultyLevelAllowed) {
+	const LevelAnalysis::LevelReportCollection collection{
+		{9,1,2,3},
+		{1,2,3,9},
+		{3,1,2,3},
+		{5,4,3,5}
+	};
+	ASSERT_NO_FATAL_FAILURE(assertNumberOfReportsMatchesWithOneFaultyLevelAllowed(collection, 4));
+}
+
+TEST_F(LevelAnalysisTests, ReportsOfDifferentLengthsSpanningMultipleBatchesWithOneFaultyLevelAllowed) {
+	const LevelAnalysis::LevelReportCollection collection{
+		{1},
+		{1,2},
+		{1,9},
+		{1,9,2},
+		{1,2,3,4,5,6,7,8,9,10,11,12},
+		{1,2,3,4,5,6,7,8,9,10,11,20},
+		{1,2,3,4,5,6,20,8,9,10,11,12},
+		{1,2,3,4,5,6,20,20,9,10,11,12},
+		{12,11,10,9,8,7,6,5,4,3,2,1},
+		{12,11,10,9,8,8,6,5,4,3,2,1},
+		{12,11,10,9,8,8,8,5,4,3,2,1}
+	};
+	ASSERT_NO_FATAL_FAILURE(assertNumberOfReportsMatches(collection, 3));
+	ASSERT_NO_FATAL_FAILURE(assertNumberOfReportsMatchesWithOneFaultyLevelAllowed(collection, 7));
+}
+
+
+TEST_F(LevelAnalysisTests, ParallelCountingOfReportsMatchesSequentialCounting) {
+	LevelAnalysis::LevelReportCollection collection;
+	for (std::size_t reportIndex = 0; reportIndex < 30001; ++reportIndex)
+	{
+		// Every third report is valid, contains one faulty level or contains two faulty levels
+		const std::size_t numFaultyLevels = reportIndex % 3;
+		for (LevelAnalysis::Level levelIndex = 0; levelIndex < 5; ++levelIndex)
+		{
+			const bool isFaultyLevel = (numFaultyLevels >= 1 && levelIndex == 2) || (numFaultyLevels == 2 && levelIndex == 4);
+			collection.appendLevelToCurrentReport(isFaultyLevel ? 50 : 20 + levelIndex);
+		}
+		collection.finishReport();
+	}
+
+	const std::size_t expectedNumberOfValidReports = LevelAnalysis::determineNumberOfValidReports(collection);
+	const std::size_t expectedNumberOfValidReportsAllowingOneFaultyLevel = LevelAnalysis::determineNumberOfValidReportsAllowingOneFaultyLevel(collection);
+	ASSERT_EQ(10001, expectedNumberOfValidReports);
+	ASSERT_EQ(20001, expectedNumberOfValidReportsAllowingOneFaultyLevel);
+	ASSERT_EQ(expectedNumberOfValidReports, LevelAnalysis::determineNumberOfValidReports(collection, 4));
+	ASSERT_EQ(expectedNumberOfValidReportsAllowingOneFaultyLevel, LevelAnalysis::determineNumberOfValidReportsAllowingOneFaultyLevel(collection, 4));
+}
+
+
+TEST_F(LevelAnalysisTests, StreamingValidationOfExampleReports) {
+	std::istringstream inputStream("7 6 4 2 1\n1 2 7 8 9\n9 7 6 2 1\n1 3 2 4 5\n8 6 4 4 1\n1 3 6 7 9\n9 1 2 3\n1 2 3 9\n1\n1 9 2\n");
+	const std::optional<LevelAnalysis::NumbersOfValidReports> numbersOfValidReports = LevelAnalysis::determineNumbersOfValidReports(inputStream);
+	ASSERT_TRUE(numbersOfValidReports.has_value());
+	ASSERT_EQ(2, numbersOfValidReports->numValidReports);
+	ASSERT_EQ(7, numbersOfValidReports->numValidReportsAllowingOneFaultyLevel);
+}
+
+TEST_F(LevelAnalysisTests, StreamingValidationOfMalformedReports) {
+	std::istringstream inputStreamWithEmptyLine("1 2 3\n\n4 5 6");
+	ASSERT_FALSE(LevelAnalysis::determineNumbersOfValidReports(inputStreamWithEmptyLine).has_value());
+
+	std::istringstream inputStreamWithNoneDigit("1 2 a");
+	ASSERT_FALSE(LevelAnalysis::determineNumbersOfValidReports(inputStreamWithNoneDigit).has_value());
+}
+
+TEST_F(LevelAnalysisTests, ReportsWithMultipleFaultyLevelsAllowed) {
+	const LevelAnalysis::LevelReportCollection collection{
+		{1},
+		{1,9},
+		{1,9,2},
+		{1,2,3,4,5},
+		{1,2,9,3,4},
+		{1,9,2,9,3},
+		{9,9,1,2,3},
+		{1,9,9,9,2},
+		{5,1,9,9,2,3},
+		{1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,50,21,22,23,24,25,26,27,28,50,50}
+	};
+	ASSERT_EQ(LevelAnalysis::determineNumberOfValidReports(collection), LevelAnalysis::determineNumberOfValidReportsAllowingFaultyLevels(collection, 0));
+	ASSERT_EQ(LevelAnalysis::determineNumberOfValidReportsAllowingOneFaultyLevel(collection), LevelAnalysis::determineNumberOfValidReportsAllowingFaultyLevels(collection, 1));
+	ASSERT_EQ(1, LevelAnalysis::determineNumberOfValidReportsAllowingFaultyLevels(collection, 0));
+	ASSERT_EQ(3, LevelAnalysis::determineNumberOfValidReportsAllowingFaultyLevels(collection, 1));
+	ASSERT_EQ(5, LevelAnalysis::determineNumberOfValidReportsAllowingFaultyLevels(collection, 2));
+	ASSERT_EQ(8, LevelAnalysis::determineNumberOfValidReportsAllowingFaultyLevels(collection, 3));
+}
+
+TEST_F(LevelAnalysisTests, ValidationOfExampleReportsFromBuffer) {
+	const std::string inputBuffer = "7 6 4 2 1\n1 2 7 8 9\n9 7 6 2 1\n1 3 2 4 5\n8 6 4 4 1\n1 3 6 7 9";
+	ASSERT_EQ(std::optional<std::size_t>(2), LevelAnalysis::determineNumberOfValidReportsFromBuffer(inputBuffer));
+	ASSERT_EQ(std::optional<std::size_t>(4), LevelAnalysis::determineNumberOfValidReportsAllowingOneFaultyLevelFromBuffer(inputBuffer));
+}
+
+TEST_F(LevelAnalysisTests, ParsingOfReportsFromBuffer) {
+	const std::optional<LevelAnalysis::LevelReportCollection> levelReports = LevelAnalysis::parseLevelReportsFromBuffer("1 2 3\n123456789 4000000000\n5\n");
+	ASSERT_TRUE(levelReports.has_value());
+	ASSERT_EQ(3, levelReports->size());
+	ASSERT_EQ(std::vector<LevelAnalysis::Level>({ 1, 2, 3 }), std::vector<LevelAnalysis::Level>((*levelReports)[0].begin(), (*levelReports)[0].end()));
+	ASSERT_EQ(std::vector<LevelAnalysis::Level>({ 123456789, 4000000000 }), std::vector<LevelAnalysis::Level>((*levelReports)[1].begin(), (*levelReports)[1].end()));
+	ASSERT_EQ(std::vector<LevelAnalysis::Level>({ 5 }), std::vector<LevelAnalysis::Level>((*levelReports)[2].begin(), (*levelReports)[2].end()));
+
+	ASSERT_FALSE(LevelAnalysis::parseLevelReportsFromBuffer("1 2 \n").has_value());
+	ASSERT_FALSE(LevelAnalysis::parseLevelReportsFromBuffer("1  2\n").has_value());
+	ASSERT_FALSE(LevelAnalysis::parseLevelReportsFromBuffer("1 5000000000\n").has_value());
+}
+
+TEST_F(LevelAnalysisTests, VerdictBitmapsOfExampleReports) {
+	const LevelAnalysis::LevelReportCollection collection{
+		{7,6,4,2,1},
+		{1,2,7,8,9},
+		{9,7,6,2,1},
+		{1,3,2,4,5},
+		{8,6,4,4,1},
+		{1,3,6,7,9},
+		{1},
+		{1,9,2},
+		{1,2,3,4,5,6,7,8,9,10,11,12}
+	};
+	const LevelAnalysis::LevelReportVerdictBitmaps verdictBitmaps = LevelAnalysis::determineVerdictsOfReports(collection);
+	ASSERT_EQ(9, verdictBitmaps.numReports);
+	ASSERT_EQ(std::vector<LevelAnalysis::LevelReportVerdictMask>({ 0b00100001, 0b1 }), verdictBitmaps.validReports);
+	ASSERT_EQ(std::vector<LevelAnalysis::LevelReportVerdictMask>({ 0b10111001, 0b1 }), verdictBitmaps.validReportsAllowingOneFaultyLevel);
+	ASSERT_TRUE(verdictBitmaps.isReportValid(5));
+	ASSERT_FALSE(verdictBitmaps.isReportValid(7));
+	ASSERT_TRUE(verdictBitmaps.isReportValidAllowingOneFaultyLevel(7));
+}
+
+TEST_F(LevelAnalysisTests, ParallelDeterminationOfVerdictBitmapsMatchesSequentialOne) {
+	LevelAnalysis::LevelReportCollection collection;
+	for (std::size_t reportIndex = 0; reportIndex < 20003; ++reportIndex)
+	{
+		for (LevelAnalysis::Level levelIndex = 0; levelIndex < 4; ++levelIndex)
+			collection.appendLevelToCurrentReport(levelIndex == reportIndex % 5 ? 50 : 10 + levelIndex);
+		collection.finishReport();
+	}
+
+	const LevelAnalysis::LevelReportVerdictBitmaps sequentialVerdictBitmaps = LevelAnalysis::determineVerdictsOfReports(collection);
+	const LevelAnalysis::LevelReportVerdictBitmaps parallelVerdictBitmaps = LevelAnalysis::determineVerdictsOfReports(collection, 3);
+	ASSERT_EQ(sequentialVerdictBitmaps.validReports, parallelVerdictBitmaps.validReports);
+	ASSERT_EQ(sequentialVerdictBitmaps.validReportsAllowingOneFaultyLevel, parallelVerdictBitmaps.validReportsAllowingOneFaultyLevel);
+	for (std::size_t reportIndex = 0; reportIndex < collection.size(); ++reportIndex)
+	{
+		ASSERT_EQ(reportIndex % 5 == 4, sequentialVerdictBitmaps.isReportValid(reportIndex));
+		ASSERT_TRUE(sequentialVerdictBitmaps.isReportValidAllowingOneFaultyLevel(reportIndex));
+	}
+}
+
+TEST_F(LevelAnalysisTests, DeltaEncodedReportsMatchPlainReports) {
+	// Contains differences that are not representable by a delta whose sum is within the limits after the removal of the level in between
+	const std::string inputBuffer = "7 6 4 2 1\n1 2 7 8 9\n9 7 6 2 1\n1 3 2 4 5\n8 6 4 4 1\n1 3 6 7 9\n"
+		"1 2 4000000000 3 4\n4000000000 4000000001 4000000002\n4000000000 1 2 3\n5 300 6 400 7\n1 2 129 4\n10 9 8 -\n";
+	ASSERT_FALSE(LevelAnalysis::parseDeltaEncodedLevelReportsFromBuffer(inputBuffer).has_value());
+
+	const std::string_view validInputBuffer = std::string_view(inputBuffer).substr(0, inputBuffer.rfind("10 9 8"));
+	const std::optional<LevelAnalysis::LevelReportCollection> levelReports = LevelAnalysis::parseLevelReportsFromBuffer(validInputBuffer);
+	const std::optional<LevelAnalysis::DeltaEncodedLevelReportCollection> deltaEncodedLevelReports = LevelAnalysis::parseDeltaEncodedLevelReportsFromBuffer(validInputBuffer);
+	ASSERT_TRUE(levelReports.has_value());
+	ASSERT_TRUE(deltaEncodedLevelReports.has_value());
+	ASSERT_EQ(levelReports->size(), deltaEncodedLevelReports->size());
+	ASSERT_EQ(4000000000, (*deltaEncodedLevelReports)[7].front());
+
+	ASSERT_EQ(3, LevelAnalysis::determineNumberOfValidReports(*deltaEncodedLevelReports));
+	ASSERT_EQ(8, LevelAnalysis::determineNumberOfValidReportsAllowingOneFaultyLevel(*deltaEncodedLevelReports));
+	ASSERT_EQ(LevelAnalysis::determineNumberOfValidReportsAllowingOneFaultyLevel(*levelReports), LevelAnalysis::determineNumberOfValidReportsAllowingOneFaultyLevel(*deltaEncodedLevelReports));
+
+	const LevelAnalysis::LevelReportVerdictBitmaps verdictBitmaps = LevelAnalysis::determineVerdictsOfReports(*levelReports);
+	const LevelAnalysis::LevelReportVerdictBitmaps deltaEncodedVerdictBitmaps = LevelAnalysis::determineVerdictsOfReports(*deltaEncodedLevelReports);
+	ASSERT_EQ(verdictBitmaps.validReports, deltaEncodedVerdictBitmaps.validReports);
+	ASSERT_EQ(verdictBitmaps.validReportsAllowingOneFaultyLevel, deltaEncodedVerdictBitmaps.validReportsAllowingOneFaultyLevel);
+}
+
+TEST_F(LevelAnalysisTests, EmptyLevelReportCollection) {
+	const LevelAnalysis::LevelReportCollection collection;
+	ASSERT_TRUE(collection.empty());
+	ASSERT_EQ(0, collection.size());
+}
+
+TEST_F(LevelAnalysisTests, LevelReportCollectionKeepsReportBoundaries) {
+	LevelAnalysis::LevelReportCollection collection;
+	for (const LevelAnalysis::Level level : { 1, 2, 3 })
+		collection.appendLevelToCurrentReport(level);
+	collection.finishReport();
+	collection.appendLevelToCurrentReport(7);
+	collection.finishReport();
+	for (const LevelAnalysis::Level level : { 9, 8 })
+		collection.appendLevelToCurrentReport(level);
+	collection.finishReport();
+
+	ASSERT_FALSE(collection.empty());
+	ASSERT_EQ(3, collection.size());
+	ASSERT_EQ(std::vector<LevelAnalysis::Level>({ 1, 2, 3 }), std::vector<LevelAnalysis::Level>(collection[0].begin(), collection[0].end()));
+	ASSERT_EQ(1, collection[1].size());
+	ASSERT_EQ(7, collection[1].front());
+	ASSERT_EQ(7, collection[1].back());
+	ASSERT_EQ(2, collection[2].size());
+	ASSERT_EQ(9, collection[2][0]);
+	ASSERT_EQ(8, collection[2][1]);
+}
+
+TEST_F(LevelAnalysisTests, EmptyReportsOfLevelReportCollection) {
+	LevelAnalysis::LevelReportCollection collection;
+	collection.finishReport();
+	collection.appendLevelToCurrentReport(4);
+	collection.appendLevelToCurrentReport(5);
+	collection.finishReport();
+	collection.finishReport();
+	collection.finishReport();
+
+	ASSERT_EQ(4, collection.size());
+	ASSERT_TRUE(collection[0].empty());
+	ASSERT_EQ(collection[0].begin(), collection[0].end());
+	ASSERT_EQ(std::vector<LevelAnalysis::Level>({ 4, 5 }), std::vector<LevelAnalysis::Level>(collection[1].begin(), collection[1].end()));
+	ASSERT_TRUE(collection[2].empty());
+	ASSERT_TRUE(collection[3].empty());
+
+	const LevelAnalysis::LevelReportCollection initializedCollection{ {}, { 1, 2 }, {} };
+	ASSERT_EQ(3, initializedCollection.size());
+	ASSERT_TRUE(initializedCollection[0].empty());
+	ASSERT_EQ(2, initializedCollection[1].size());
+	ASSERT_TRUE(initializedCollection[2].empty());
+}
+
+TEST_F(LevelAnalysisTests, LevelsOfLevelReportCollectionReadBackAfterManyAppends) {
+	// The number of levels per report varies to let the levels of the reports start at arbitrary offsets while the underlying container is reallocated many times
+	constexpr std::size_t numReports = 10000;
+	LevelAnalysis::LevelReportCollection collection;
+	std::vector<std::vector<LevelAnalysis::Level>> expectedReports(numReports);
+	for (std::size_t reportIndex = 0; reportIndex < numReports; ++reportIndex)
+	{
+		for (std::size_t levelIndex = 0; levelIndex < reportIndex % 9; ++levelIndex)
+		{
+			const auto level = static_cast<LevelAnalysis::Level>(reportIndex * 16 + levelIndex);
+			expectedReports[reportIndex].emplace_back(level);
+			collection.appendLevelToCurrentReport(level);
+		}
+		collection.finishReport();
+	}
+
+	ASSERT_EQ(numReports, collection.size());
+	for (std::size_t reportIndex = 0; reportIndex < numReports; ++reportIndex)
+	{
+		const LevelAnalysis::LevelReport levelReport = collection[reportIndex];
+		ASSERT_EQ(expectedReports[reportIndex], std::vector<LevelAnalysis::Level>(levelReport.begin(), levelReport.end())) << "Levels of report " << reportIndex << " differ";
+	}
+}
 
 TEST_F(LevelAnalysisTests, BigInputExampleForLevelReports) {
 	const std::string inputFilename = "../data/input_day02.txt";
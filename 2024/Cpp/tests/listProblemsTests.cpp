@@ -0,0 +1,293 @@
+#include "../Day01/incrementalListProblems.hpp"
+#include "../Day01/listProblems.hpp"
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Day01;
+
+class ListProblemsTests : public testing::Test {
+public:
+	static void assertListsParsedFromBufferMatch(std::string_view inputBuffer, const std::optional<ListProblems::ListColumns>& expectedLists, std::size_t numThreads = 0)
+	{
+		std::optional<ListProblems::ListColumns> actualLists;
+		ASSERT_NO_THROW(actualLists = ListProblems::parseListsFromBuffer(inputBuffer, numThreads));
+		ASSERT_EQ(expectedLists.has_value(), actualLists.has_value());
+		if (!expectedLists.has_value())
+			return;
+
+		ASSERT_EQ(expectedLists->listOne, actualLists->listOne);
+		ASSERT_EQ(expectedLists->listTwo, actualLists->listTwo);
+	}
+
+	static void assertSumOfPairwiseDistancesMatches(std::vector<ListProblems::ListElement> listOne, std::vector<ListProblems::ListElement> listTwo, std::optional<long> expectedSumOfPairwiseDistances, std::size_t numThreads = 1)
+	{
+		std::optional<long> actualSumOfPairwiseDistances;
+		ASSERT_NO_THROW(actualSumOfPairwiseDistances = ListProblems::calculateSumOfPairwiseDistancesOfSortableLists(listOne, listTwo, numThreads));
+		ASSERT_EQ(expectedSumOfPairwiseDistances, actualSumOfPairwiseDistances);
+	}
+
+	static void assertSimilarityScoreMatches(std::vector<ListProblems::ListElement> listOne, std::vector<ListProblems::ListElement> listTwo, long expectedSimilarityScore)
+	{
+		long actualSimilarityScore = 0;
+		ASSERT_NO_THROW(actualSimilarityScore = ListProblems::calculateSimilarityScore(listOne.cbegin(), listOne.cend(), listTwo.cbegin(), listTwo.cend()));
+		ASSERT_EQ(expectedSimilarityScore, actualSimilarityScore);
+
+		ListProblems::SumOfPairwiseDistancesAndSimilarityScore actualMetricsFromSortedLists;
+		ASSERT_NO_THROW(actualMetricsFromSortedLists = ListProblems::calculateSumOfPairwiseDistancesAndSimilarityScoreOfSortableLists(listOne, listTwo));
+		ASSERT_EQ(expectedSimilarityScore, actualMetricsFromSortedLists.similarityScore);
+	}
+};
+
+TEST_F(ListProblemsTests, ParseExampleLists) {
+	const std::string inputBuffer = "3   4\n4   3\n2   5\n1   3\n3   9\n3   3\n";
+	ASSERT_NO_FATAL_FAILURE(assertListsParsedFromBufferMatch(inputBuffer, ListProblems::ListColumns{ {3, 4, 2, 1, 3, 3}, {4, 3, 5, 3, 9, 3} }));
+}
+
+TEST_F(ListProblemsTests, ParseListsWithWindowsLineEndingsAndWithoutTrailingNewline) {
+	const std::string inputBuffer = "3   4\r\n4\t3\r\n\r\n-2 5";
+	ASSERT_NO_FATAL_FAILURE(assertListsParsedFromBufferMatch(inputBuffer, ListProblems::ListColumns{ {3, 4, -2}, {4, 3, 5} }));
+}
+
+TEST_F(ListProblemsTests, ParseEmptyBuffer) {
+	ASSERT_NO_FATAL_FAILURE(assertListsParsedFromBufferMatch("", ListProblems::ListColumns{}));
+}
+
+TEST_F(ListProblemsTests, ParseRowWithMissingColumnFails) {
+	ASSERT_NO_FATAL_FAILURE(assertListsParsedFromBufferMatch("3   4\n4\n", std::nullopt));
+}
+
+TEST_F(ListProblemsTests, ParseRowWithInvalidCharacterFails) {
+	ASSERT_NO_FATAL_FAILURE(assertListsParsedFromBufferMatch("3   4\n4   3a\n", std::nullopt));
+}
+
+TEST_F(ListProblemsTests, ParseListsWithNumbersSpanningMultipleDigitBlocks) {
+	const std::string inputBuffer = "1234567890   -2147483648\n00000000042   7\n12345678   -87654321";
+	ASSERT_NO_FATAL_FAILURE(assertListsParsedFromBufferMatch(inputBuffer, ListProblems::ListColumns{ {1234567890, 42, 12345678}, {-2147483648L, 7, -87654321} }));
+}
+
+TEST_F(ListProblemsTests, ParseRowWithOverflowingNumberFails) {
+	ASSERT_NO_FATAL_FAILURE(assertListsParsedFromBufferMatch("99999999999999999999   1\n", std::nullopt));
+}
+
+TEST_F(ListProblemsTests, ParseListsSplitIntoMultipleChunks) {
+	constexpr std::size_t numRows = 100000;
+	ListProblems::ListColumns expectedLists;
+	std::string inputBuffer;
+	for (std::size_t i = 0; i < numRows; ++i)
+	{
+		expectedLists.listOne.emplace_back(static_cast<ListProblems::ListElement>(i));
+		expectedLists.listTwo.emplace_back(static_cast<ListProblems::ListElement>(numRows - i));
+		inputBuffer += std::to_string(i) + "   " + std::to_string(numRows - i) + "\n";
+	}
+	ASSERT_NO_FATAL_FAILURE(assertListsParsedFromBufferMatch(inputBuffer, expectedLists, 7));
+}
+
+TEST_F(ListProblemsTests, SumOfPairwiseDistancesOfExampleLists) {
+	ASSERT_NO_FATAL_FAILURE(assertSumOfPairwiseDistancesMatches({ 3, 4, 2, 1, 3, 3 }, { 4, 3, 5, 3, 9, 3 }, 11));
+}
+
+TEST_F(ListProblemsTests, SumOfPairwiseDistancesOfListsWithDifferentLengths) {
+	ASSERT_NO_FATAL_FAILURE(assertSumOfPairwiseDistancesMatches({ 3, 4 }, { 4 }, std::nullopt));
+}
+
+TEST_F(ListProblemsTests, SumOfPairwiseDistancesOfLargeListsSortedInParallel) {
+	constexpr std::size_t numElements = 300000;
+	std::vector<ListProblems::ListElement> listOne;
+	std::vector<ListProblems::ListElement> listTwo;
+	for (std::size_t i = 0; i < numElements; ++i)
+	{
+		// Both lists are permutations of the values 10000..309999 with the second list being offset by two
+		listOne.emplace_back(static_cast<ListProblems::ListElement>(10000 + (i * 7919) % numElements));
+		listTwo.emplace_back(static_cast<ListProblems::ListElement>(10002 + (i * 104729) % numElements));
+	}
+	ASSERT_NO_FATAL_FAILURE(assertSumOfPairwiseDistancesMatches(listOne, listTwo, 2 * static_cast<long>(numElements), 3));
+}
+
+TEST_F(ListProblemsTests, SumOfPairwiseDistancesAccumulatedInParallelMatchesSerialSum) {
+	// An odd number of elements assigns the remaining elements to the last thread
+	constexpr std::size_t numElements = 1003;
+	std::vector<ListProblems::ListElement> listOne;
+	std::vector<ListProblems::ListElement> listTwo;
+	for (std::size_t i = 0; i < numElements; ++i)
+	{
+		listOne.emplace_back(static_cast<ListProblems::ListElement>((i * 7919) % 5003));
+		listTwo.emplace_back(static_cast<ListProblems::ListElement>((i * 104729) % 7001));
+	}
+
+	std::vector<ListProblems::ListElement> seriallyProcessedListOne = listOne;
+	std::vector<ListProblems::ListElement> seriallyProcessedListTwo = listTwo;
+	const std::optional<long> expectedSumOfPairwiseDistances = ListProblems::calculateSumOfPairwiseDistancesOfSortableLists(seriallyProcessedListOne, seriallyProcessedListTwo, 1);
+	ASSERT_TRUE(expectedSumOfPairwiseDistances.has_value());
+
+	for (const std::size_t numThreads : { 2, 3, 4, 8 })
+	{
+		std::vector<ListProblems::ListElement> listOneProcessedInParallel = listOne;
+		std::vector<ListProblems::ListElement> listTwoProcessedInParallel = listTwo;
+		ASSERT_EQ(expectedSumOfPairwiseDistances, ListProblems::calculateSumOfPairwiseDistancesOfSortableLists(listOneProcessedInParallel, listTwoProcessedInParallel, numThreads, 1)) << "Mismatch when using " << numThreads << " threads";
+	}
+}
+
+TEST_F(ListProblemsTests, NegativeElementDetectedByParallelAccumulation) {
+	std::vector<ListProblems::ListElement> listOne = { 1, 2, 3, 4, 5, 6, 7, -8 };
+	std::vector<ListProblems::ListElement> listTwo = { 8, 7, 6, 5, 4, 3, 2, 1 };
+	ASSERT_EQ(std::nullopt, ListProblems::calculateSumOfPairwiseDistancesOfSortableLists(listOne, listTwo, 4, 1));
+}
+
+TEST_F(ListProblemsTests, SumOfPairwiseDistancesOfListsWithNegativeElements) {
+	ASSERT_NO_FATAL_FAILURE(assertSumOfPairwiseDistancesMatches({ 3, -4 }, { 4, 3 }, std::nullopt));
+}
+
+TEST_F(ListProblemsTests, SimilarityScoreOfExampleLists) {
+	ASSERT_NO_FATAL_FAILURE(assertSimilarityScoreMatches({ 3, 4, 2, 1, 3, 3 }, { 4, 3, 5, 3, 9, 3 }, 31));
+}
+
+TEST_F(ListProblemsTests, SimilarityScoreOfListsWithValueRangeTooLargeForCountingArray) {
+	ASSERT_NO_FATAL_FAILURE(assertSimilarityScoreMatches({ 5, 1000000000, -7, 5 }, { 1000000000, -7, 5, 3, -7 }, 1000000000 - 14 + 10));
+}
+
+TEST_F(ListProblemsTests, SimilarityScoreOfListsWithoutCommonElements) {
+	ASSERT_NO_FATAL_FAILURE(assertSimilarityScoreMatches({ 1, 2, 3 }, { 4, 5, 6 }, 0));
+}
+
+TEST_F(ListProblemsTests, OutOfCoreCalculationMatchesInMemoryCalculation) {
+	constexpr std::size_t numRows = 5000;
+	std::vector<ListProblems::ListElement> listOne;
+	std::vector<ListProblems::ListElement> listTwo;
+	const std::filesystem::path inputFilePath = std::filesystem::temp_directory_path() / "listProblemsTests_outOfCore.txt";
+	{
+		std::ofstream inputFile(inputFilePath, std::ios::binary | std::ios::trunc);
+		ASSERT_TRUE(inputFile.is_open());
+		for (std::size_t i = 0; i < numRows; ++i)
+		{
+			listOne.emplace_back(static_cast<ListProblems::ListElement>(10000 + (i * 7919) % 3000));
+			listTwo.emplace_back(static_cast<ListProblems::ListElement>(10000 + (i * 104729) % 5000));
+			inputFile << listOne.back() << "   " << listTwo.back() << "\n";
+		}
+	}
+
+	const ListProblems::SumOfPairwiseDistancesAndSimilarityScore expectedListMetrics = ListProblems::calculateSumOfPairwiseDistancesAndSimilarityScoreOfSortableLists(listOne, listTwo);
+	std::optional<ListProblems::SumOfPairwiseDistancesAndSimilarityScore> actualListMetrics;
+	ASSERT_NO_THROW(actualListMetrics = ListProblems::calculateSumOfPairwiseDistancesAndSimilarityScoreOutOfCore(inputFilePath.string(), ListProblems::MIN_EXTERNAL_MEMORY_BUDGET_IN_BYTES));
+	std::filesystem::remove(inputFilePath);
+
+	ASSERT_TRUE(actualListMetrics.has_value());
+	ASSERT_EQ(expectedListMetrics.sumOfPairwiseDistances, actualListMetrics->sumOfPairwiseDistances);
+	ASSERT_EQ(expectedListMetrics.similarityScore, actualListMetrics->similarityScore);
+}
+
+TEST_F(ListProblemsTests, OutOfCoreCalculationMergingRunsInMultiplePasses) {
+	// The minimum budget fits about 2000 elements per run of which at most 8 runs per list can be merged at once, thus requiring two additional passes to merge the runs of this input
+	constexpr std::size_t numRows = 300000;
+	std::vector<ListProblems::ListElement> listOne;
+	std::vector<ListProblems::ListElement> listTwo;
+	const std::filesystem::path inputFilePath = std::filesystem::temp_directory_path() / "listProblemsTests_outOfCoreMultiplePasses.txt";
+	{
+		std::ofstream inputFile(inputFilePath, std::ios::binary | std::ios::trunc);
+		ASSERT_TRUE(inputFile.is_open());
+		for (std::size_t i = 0; i < numRows; ++i)
+		{
+			listOne.emplace_back(static_cast<ListProblems::ListElement>((i * 7919) % 250000));
+			listTwo.emplace_back(static_cast<ListProblems::ListElement>((i * 104729) % 300007));
+			inputFile << listOne.back() << "   " << listTwo.back() << "\n";
+		}
+	}
+
+	const ListProblems::SumOfPairwiseDistancesAndSimilarityScore expectedListMetrics = ListProblems::calculateSumOfPairwiseDistancesAndSimilarityScoreOfSortableLists(listOne, listTwo);
+	std::optional<ListProblems::SumOfPairwiseDistancesAndSimilarityScore> actualListMetrics;
+	ASSERT_NO_THROW(actualListMetrics = ListProblems::calculateSumOfPairwiseDistancesAndSimilarityScoreOutOfCore(inputFilePath.string(), ListProblems::MIN_EXTERNAL_MEMORY_BUDGET_IN_BYTES));
+	std::filesystem::remove(inputFilePath);
+
+	ASSERT_TRUE(actualListMetrics.has_value());
+	ASSERT_EQ(expectedListMetrics.sumOfPairwiseDistances, actualListMetrics->sumOfPairwiseDistances);
+	ASSERT_EQ(expectedListMetrics.similarityScore, actualListMetrics->similarityScore);
+}
+
+TEST_F(ListProblemsTests, IncrementalMetricsOfExampleLists) {
+	IncrementalListProblems incrementalListProblems(10);
+	for (const ListProblems::ListElement element : { 3, 4, 2, 1, 3, 3 })
+		ASSERT_TRUE(incrementalListProblems.insertElement(IncrementalListProblems::ListIdentifier::ListOne, element));
+
+	ASSERT_EQ(std::nullopt, incrementalListProblems.getSumOfPairwiseDistances());
+	for (const ListProblems::ListElement element : { 4, 3, 5, 3, 9, 3 })
+		ASSERT_TRUE(incrementalListProblems.insertElement(IncrementalListProblems::ListIdentifier::ListTwo, element));
+
+	ASSERT_EQ(11, incrementalListProblems.getSumOfPairwiseDistances());
+	ASSERT_EQ(31, incrementalListProblems.getSimilarityScore());
+
+	ASSERT_TRUE(incrementalListProblems.removeElement(IncrementalListProblems::ListIdentifier::ListTwo, 9));
+	ASSERT_TRUE(incrementalListProblems.removeElement(IncrementalListProblems::ListIdentifier::ListOne, 1));
+	// Remaining lists {2, 3, 3, 3, 4} and {3, 3, 3, 4, 5}
+	ASSERT_EQ(3, incrementalListProblems.getSumOfPairwiseDistances());
+	ASSERT_EQ(31, incrementalListProblems.getSimilarityScore());
+}
+
+TEST_F(ListProblemsTests, IncrementalUpdatesOutsideOfValueDomainOrOfMissingElementsAreRejected) {
+	IncrementalListProblems incrementalListProblems(10);
+	ASSERT_FALSE(incrementalListProblems.insertElement(IncrementalListProblems::ListIdentifier::ListOne, 11));
+	ASSERT_FALSE(incrementalListProblems.insertElement(IncrementalListProblems::ListIdentifier::ListOne, -1));
+	ASSERT_FALSE(incrementalListProblems.removeElement(IncrementalListProblems::ListIdentifier::ListTwo, 5));
+	ASSERT_EQ(0, incrementalListProblems.getSumOfPairwiseDistances());
+}
+
+TEST_F(ListProblemsTests, IncrementalMetricsMatchRecalculatedMetricsAfterEveryUpdate) {
+	constexpr ListProblems::ListElement maxElementValue = 50;
+	IncrementalListProblems incrementalListProblems(maxElementValue);
+	std::vector<ListProblems::ListElement> listOne;
+	std::vector<ListProblems::ListElement> listTwo;
+
+	std::size_t pseudoRandomState = 12345;
+	for (std::size_t i = 0; i < 2000; ++i)
+	{
+		pseudoRandomState = (pseudoRandomState * 1103515245 + 12345) % 2147483648;
+		const bool updateListOne = pseudoRandomState & 1;
+		const bool removeElement = (pseudoRandomState >> 1) % 3 == 0;
+		const auto element = static_cast<ListProblems::ListElement>((pseudoRandomState >> 3) % (maxElementValue + 1));
+
+		std::vector<ListProblems::ListElement>& updatedList = updateListOne ? listOne : listTwo;
+		const auto listIdentifier = updateListOne ? IncrementalListProblems::ListIdentifier::ListOne : IncrementalListProblems::ListIdentifier::ListTwo;
+		if (removeElement)
+		{
+			const auto matchingElement = std::find(updatedList.begin(), updatedList.end(), element);
+			ASSERT_EQ(matchingElement != updatedList.end(), incrementalListProblems.removeElement(listIdentifier, element));
+			if (matchingElement != updatedList.end())
+				updatedList.erase(matchingElement);
+		}
+		else
+		{
+			ASSERT_TRUE(incrementalListProblems.insertElement(listIdentifier, element));
+			updatedList.emplace_back(element);
+		}
+
+		std::vector<ListProblems::ListElement> sortedListOne = listOne;
+		std::vector<ListProblems::ListElement> sortedListTwo = listTwo;
+		const ListProblems::SumOfPairwiseDistancesAndSimilarityScore expectedListMetrics = ListProblems::calculateSumOfPairwiseDistancesAndSimilarityScoreOfSortableLists(sortedListOne, sortedListTwo);
+		ASSERT_EQ(expectedListMetrics.sumOfPairwiseDistances, incrementalListProblems.getSumOfPairwiseDistances());
+		ASSERT_EQ(expectedListMetrics.similarityScore, incrementalListProblems.getSimilarityScore());
+	}
+}
+
+TEST_F(ListProblemsTests, SumOfPairwiseDistancesOfAlreadySortedLists) {
+	const std::vector<ListProblems::ListElement> listOne{ 1, 2, 3, 3, 3, 4 };
+	const std::vector<ListProblems::ListElement> listTwo{ 3, 3, 3, 4, 5, 9 };
+	ASSERT_EQ(11, ListProblems::calculateSumOfPairwiseDistances(listOne.cbegin(), listOne.cend(), listTwo.cbegin(), listTwo.cend()));
+}
+
+TEST_F(ListProblemsTests, SumOfPairwiseDistancesOfListsConsistingOfFewAscendingRuns) {
+	constexpr std::size_t numElements = 10000;
+	std::vector<ListProblems::ListElement> listOne;
+	std::vector<ListProblems::ListElement> listTwo;
+	for (std::size_t i = 0; i < numElements; ++i)
+	{
+		// The first list consists of five interleaved ascending runs while the second list is sorted in descending order
+		listOne.emplace_back(static_cast<ListProblems::ListElement>((i % (numElements / 5)) * 5 + i / (numElements / 5)));
+		listTwo.emplace_back(static_cast<ListProblems::ListElement>(numElements - i + 1));
+	}
+	ASSERT_NO_FATAL_FAILURE(assertSumOfPairwiseDistancesMatches(listOne, listTwo, 2 * static_cast<long>(numElements)));
+}
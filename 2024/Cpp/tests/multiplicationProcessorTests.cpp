@@ -1,8 +1,38 @@
 #include "../Day03/multiplicationProcessor.hpp"
+#include "../Day03/streamingMultiplicationProcessor.hpp"
 #include <gtest/gtest.h>
 
 using namespace Day03;
 
+struct AddInstruction
+{
+	static constexpr std::string_view NAME = "add";
+	static constexpr std::size_t ARITY = 2;
+	static constexpr InstructionSemantics SEMANTICS = InstructionSemantics::AddSumOfOperands;
+};
+
+// The product of a single operand is the operand itself
+struct IdentityInstruction
+{
+	static constexpr std::string_view NAME = "id";
+	static constexpr std::size_t ARITY = 1;
+	static constexpr InstructionSemantics SEMANTICS = InstructionSemantics::AddProductOfOperands;
+};
+
+struct OnInstruction
+{
+	static constexpr std::string_view NAME = "on";
+	static constexpr std::size_t ARITY = 0;
+	static constexpr InstructionSemantics SEMANTICS = InstructionSemantics::EnableEvaluation;
+};
+
+struct OffInstruction
+{
+	static constexpr std::string_view NAME = "off";
+	static constexpr std::size_t ARITY = 0;
+	static constexpr InstructionSemantics SEMANTICS = InstructionSemantics::DisableEvaluation;
+};
+
 class MultiplicationProcessorTests : public ::testing::Test {
 public:
 	static void assertSumProcessedFromStringMatches(const std::string& rawStringContent, long expectedSum)
@@ -150,6 +180,122 @@ TEST_F(MultiplicationProcessorTests, IncompleteDoKeywordDoesNotEnableMultiplicat
 	ASSERT_NO_FATAL_FAILURE(MultiplicationProcessorTests::assertSumProcessedFromStringMatches("mul(2,3)don't()()(mul(1,2)do()mul(4,5)", true, 26));
 }
 
+TEST_F(MultiplicationProcessorTests, KeywordsPreceededByPartialKeywordsDetectedCorrectly)
+{
+	ASSERT_NO_FATAL_FAILURE(MultiplicationProcessorTests::assertSumProcessedFromStringMatches("mmul(2,3)mumul(4,5)dmul(1,2)domul(3,3)", 6+20+2+9));
+	ASSERT_NO_FATAL_FAILURE(MultiplicationProcessorTests::assertSumProcessedFromStringMatches("ddon't()mul(2,3)dddo()mul(4,5)", true, 20));
+}
+
+TEST_F(MultiplicationProcessorTests, InstructionsInterruptedByStartOfOtherInstructionDetectedCorrectly)
+{
+	ASSERT_NO_FATAL_FAILURE(MultiplicationProcessorTests::assertSumProcessedFromStringMatches("mul(1,mul(2,3))mul(12dmul(4,5)mul(123,4m", 6+20));
+	ASSERT_NO_FATAL_FAILURE(MultiplicationProcessorTests::assertSumProcessedFromStringMatches("mul(2,3)don'mul(1,1)don(don't(mdon't()mul(4,5)do(mdo()mul(7,8)", true, 6+1+56));
+}
+
+TEST_F(MultiplicationProcessorTests, ExtractionOfInstructionsFromBuffer)
+{
+	const std::string inputBuffer = "xmul(2,4)&mul[3,7]!^don't()_mul(5,5)+mul(32,64](mul(11,8)undo()?mul(8,5))mul(1,";
+	MultiplicationProcessor::ExtractedInstructions extractedInstructions;
+	ASSERT_NO_FATAL_FAILURE(extractedInstructions = MultiplicationProcessor::extractInstructionsFromBuffer(inputBuffer));
+
+	using KeywordKind = MultiplicationProcessor::KeywordKind;
+	ASSERT_EQ(6, extractedInstructions.size());
+	ASSERT_EQ(std::vector<std::size_t>({ 1, 20, 28, 48, 59, 64 }), extractedInstructions.byteOffsets);
+	ASSERT_EQ(std::vector<MultiplicationProcessor::MultiplicationFactor>({ 2, 0, 5, 11, 0, 8 }), extractedInstructions.multiplicationLFactors);
+	ASSERT_EQ(std::vector<MultiplicationProcessor::MultiplicationFactor>({ 4, 0, 5, 8, 0, 5 }), extractedInstructions.multiplicationRFactors);
+	ASSERT_EQ(std::vector<KeywordKind>({ KeywordKind::Mul, KeywordKind::Dont, KeywordKind::Mul, KeywordKind::Mul, KeywordKind::Do, KeywordKind::Mul }), extractedInstructions.keywordKinds);
+}
+
+TEST_F(MultiplicationProcessorTests, InstructionsOfUserDefinedInstructionSet)
+{
+	// The on() keyword following "do" and the add(..) instruction following "m" are only recognized when falling back to a later start of an instruction
+	const std::string inputBuffer = "xmul(2,3)add(4,5)id(7)off()mul(9,9)dooon()add(10,20)madd(1,1)don't()id(3)on(id(1000)";
+	long actualSum;
+	ASSERT_NO_FATAL_FAILURE((actualSum = MultiplicationProcessor::processInstructionsFromBuffer<MulInstruction, AddInstruction, IdentityInstruction, OnInstruction, OffInstruction, DontInstruction>(inputBuffer)));
+	ASSERT_EQ(6+9+7+30+2, actualSum);
+	ASSERT_NO_FATAL_FAILURE((actualSum = MultiplicationProcessor::processInstructionsFromBuffer<MulInstruction, DoInstruction, DontInstruction>(inputBuffer)));
+	ASSERT_EQ(MultiplicationProcessor::processMultiplicationsFromBuffer(inputBuffer, true), actualSum);
+}
+
+TEST_F(MultiplicationProcessorTests, InstructionsSurroundedByLongNoiseDetectedCorrectly)
+{
+	// The noise spans multiple blocks of the prefilter with the instructions being located at and across the block boundaries
+	const std::string noise(45, 'x');
+	const std::string inputBuffer = noise + "mul(2,3)" + noise.substr(0, 19) + "don't()" + noise + "mul(4,5)" + noise.substr(0, 27) + "do()mul(7,8)" + noise + "mul(1,";
+	long actualSum;
+	ASSERT_NO_FATAL_FAILURE(actualSum = MultiplicationProcessor::processMultiplicationsFromBuffer(inputBuffer, true));
+	ASSERT_EQ(6+56, actualSum);
+	ASSERT_NO_FATAL_FAILURE(actualSum = MultiplicationProcessor::processMultiplicationsFromBuffer(inputBuffer, false));
+	ASSERT_EQ(6+20+56, actualSum);
+}
+
+TEST_F(MultiplicationProcessorTests, ParallelProcessingWithInstructionsStraddlingChunkBoundariesMatchesSequentialProcessing)
+{
+	// With four threads the chunks start at multiples of 2^16, the instructions placed at those boundaries all start in the previous chunk
+	constexpr std::size_t numBytesPerChunk = 1 << 16;
+	std::string inputBuffer(4 * numBytesPerChunk, '.');
+	inputBuffer.replace(numBytesPerChunk - 3, 10, "don't()do(");
+	inputBuffer.replace(numBytesPerChunk + 1000, 9, "mul(11,3)");
+	inputBuffer.replace(2 * numBytesPerChunk - 4, 9, "mul(12,4)");
+	inputBuffer.replace(2 * numBytesPerChunk + 40, 7, "don't()");
+	inputBuffer.replace(3 * numBytesPerChunk - 2, 4, "do()");
+	inputBuffer.replace(3 * numBytesPerChunk + 70, 9, "mul(13,5)");
+	inputBuffer.replace(4 * numBytesPerChunk - 9, 9, "mul(14,6)");
+
+	for (const bool conditionalMultiplicationEvaluationEnabled : { false, true })
+	{
+		const long expectedSum = conditionalMultiplicationEvaluationEnabled ? 13*5 + 14*6 : 11*3 + 12*4 + 13*5 + 14*6;
+		ASSERT_EQ(expectedSum, MultiplicationProcessor::processMultiplicationsFromBuffer(inputBuffer, conditionalMultiplicationEvaluationEnabled));
+		ASSERT_EQ(expectedSum, MultiplicationProcessor::processMultiplicationsFromBuffer(inputBuffer, conditionalMultiplicationEvaluationEnabled, 4));
+	}
+}
+
+TEST_F(MultiplicationProcessorTests, StreamingProcessingOfInstructionsSplitAcrossChunks)
+{
+	const std::string inputBuffer = "xmul(2,4)%&mul[3,7]!@^do_not_mul(5,5)+mul(32,64]then(mul(11,8)mul(8,5))don't()mul(12,34)do()mul(123,456)d";
+	for (const bool conditionalMultiplicationEvaluationEnabled : { false, true })
+	{
+		const long expectedSum = MultiplicationProcessor::processMultiplicationsFromBuffer(inputBuffer, conditionalMultiplicationEvaluationEnabled);
+		for (std::size_t numBytesPerChunk = 1; numBytesPerChunk <= 16; ++numBytesPerChunk)
+		{
+			StreamingMultiplicationProcessor streamingMultiplicationProcessor(conditionalMultiplicationEvaluationEnabled);
+			for (std::size_t firstByteOffsetOfChunk = 0; firstByteOffsetOfChunk < inputBuffer.size(); firstByteOffsetOfChunk += numBytesPerChunk)
+				streamingMultiplicationProcessor.feed(std::string_view(inputBuffer).substr(firstByteOffsetOfChunk, numBytesPerChunk));
+			ASSERT_EQ(expectedSum, streamingMultiplicationProcessor.currentSum());
+		}
+	}
+}
+
+TEST_F(MultiplicationProcessorTests, ByteOffsetsOfInstructionsSplitAcrossBuffers)
+{
+	// The offsets of the instructions refer to the first buffer scanned using the context, including the ones whose names are split across buffers or only recognized after falling back to a later start
+	using Scanner = InstructionScanner<MulInstruction, AddInstruction, OnInstruction, DontInstruction>;
+	const std::string inputBuffer = "xmul(2,4)mmul(3,3)don()dont()don't()madd(1,mul(5,6)adadd(7,8)on()";
+	const std::vector<std::size_t> expectedByteOffsets = { 1, 10, 19, 29, 43, 53, 61 };
+	for (std::size_t numBytesPerBuffer = 1; numBytesPerBuffer <= inputBuffer.size(); ++numBytesPerBuffer)
+	{
+		Scanner::Context context = Scanner::makeInitialContext();
+		std::vector<std::size_t> actualByteOffsets;
+		for (std::size_t firstByteOffsetOfBuffer = 0; firstByteOffsetOfBuffer < inputBuffer.size(); firstByteOffsetOfBuffer += numBytesPerBuffer)
+		{
+			const std::string_view buffer = std::string_view(inputBuffer).substr(firstByteOffsetOfBuffer, numBytesPerBuffer);
+			Scanner::scanInstructions(buffer, 0, buffer.size(), context, [&actualByteOffsets](auto, const Scanner::Context& context) { actualByteOffsets.emplace_back(context.byteOffsetOfInstruction); });
+		}
+		ASSERT_EQ(expectedByteOffsets, actualByteOffsets) << "Mismatch for buffers of " << numBytesPerBuffer << " bytes";
+	}
+}
+
+TEST_F(MultiplicationProcessorTests, StreamingProcessingReportsRunningSum)
+{
+	StreamingMultiplicationProcessor streamingMultiplicationProcessor(true);
+	streamingMultiplicationProcessor.feed("mul(2,3)mul(4");
+	ASSERT_EQ(6, streamingMultiplicationProcessor.currentSum());
+	streamingMultiplicationProcessor.feed(",5)don'");
+	ASSERT_EQ(26, streamingMultiplicationProcessor.currentSum());
+	streamingMultiplicationProcessor.feed("t()mul(1,1)");
+	ASSERT_EQ(26, streamingMultiplicationProcessor.currentSum());
+}
+
 TEST_F(MultiplicationProcessorTests, MultiplicationsFromFileWithoutConditionalEvaluationDisabled)
 {
 	long actualSum;
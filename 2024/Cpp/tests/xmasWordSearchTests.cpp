@@ -456,4 +456,22 @@ TEST_F(XmasWordSearchTests, FindMasCrossCombinationsInFile)
 	XmasWordSearchTests::assertNumberOfFoundMasCrossCombinationsInFileMatches(
 		R"(C:\School\adventOfCode\2024\data\input_day04.txt)",
 		1921);
-}
\ No newline at end of file
+}
+
+TEST_F(XmasWordSearchTests, XmasCombinationsStartingAtBorderOfWordField)
+{
+	XmasWordSearchTests::assertNumberOfFoundXmasCombinationsInStringMatches(
+		"XMAS\n"
+		"MM.A\n"
+		"A.A.\n"
+		"S..S", 3);
+}
+
+TEST_F(XmasWordSearchTests, XmasCombinationsInWordFieldWithRowsOfDifferentLength)
+{
+	XmasWordSearchTests::assertNumberOfFoundXmasCombinationsInStringMatches(
+		"XMASXMAS\n"
+		"M\n"
+		"A\n"
+		"SAMX", 4);
+}
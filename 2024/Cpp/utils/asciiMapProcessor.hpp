@@ -1,25 +1,36 @@
 #ifndef UTILS_ASCII_MAP_PROCESSOR_HPP
 #define UTILS_ASCII_MAP_PROCESSOR_HPP
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <istream>
+#include <limits>
 #include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 namespace utils
 {
-	struct AsciiMapPosition
+	/// Position in an ascii map whose coordinate type can be narrowed down to the smallest integral type able to represent the dimensions of the map.
+	template <typename Coordinate>
+	struct BasicAsciiMapPosition
 	{
-		long row;
-		long col;
+		static_assert(std::is_integral_v<Coordinate> && std::is_signed_v<Coordinate>, "Coordinates of ascii map positions must be signed integral values");
 
-		AsciiMapPosition()
+		Coordinate row;
+		Coordinate col;
+
+		BasicAsciiMapPosition()
 			: row(0), col(0) {}
 
-		explicit AsciiMapPosition(long row, long col)
+		explicit BasicAsciiMapPosition(Coordinate row, Coordinate col)
 			: row(row), col(col) {}
 
-		bool operator<(const AsciiMapPosition& other) const
+		bool operator<(const BasicAsciiMapPosition& other) const
 		{
 			if (row > other.row)
 				return false;
@@ -27,34 +38,49 @@ namespace utils
 			return row < other.row ? true : col <= other.col;
 		}
 
-		bool operator==(const AsciiMapPosition& other) const
+		bool operator==(const BasicAsciiMapPosition& other) const
 		{
 			return row == other.row && col == other.col;
 		}
 
-		bool operator !=(const AsciiMapPosition& other) const
+		bool operator !=(const BasicAsciiMapPosition& other) const
 		{
 			return row != other.row || col != other.col;
 		}
 
-		friend AsciiMapPosition operator-(const AsciiMapPosition& lPos, const AsciiMapPosition& rPos)
+		friend BasicAsciiMapPosition operator-(const BasicAsciiMapPosition& lPos, const BasicAsciiMapPosition& rPos)
 		{
-			return AsciiMapPosition(lPos.row - rPos.row, lPos.col - rPos.col);
+			return BasicAsciiMapPosition(static_cast<Coordinate>(lPos.row - rPos.row), static_cast<Coordinate>(lPos.col - rPos.col));
 		}
 
-		friend AsciiMapPosition operator+(const AsciiMapPosition& lPos, const AsciiMapPosition& rPos)
+		friend BasicAsciiMapPosition operator+(const BasicAsciiMapPosition& lPos, const BasicAsciiMapPosition& rPos)
 		{
-			return AsciiMapPosition(lPos.row + rPos.row, lPos.col + rPos.col);
+			return BasicAsciiMapPosition(static_cast<Coordinate>(lPos.row + rPos.row), static_cast<Coordinate>(lPos.col + rPos.col));
 		}
 
-		long operator()(const AsciiMapPosition& mapPositionToHash) const noexcept {
-			return std::hash<long>()(mapPositionToHash.row) * 31 + std::hash<long>()(mapPositionToHash.col);
+		std::size_t operator()(const BasicAsciiMapPosition& mapPositionToHash) const noexcept {
+			return std::hash<Coordinate>()(mapPositionToHash.row) * 31 + std::hash<Coordinate>()(mapPositionToHash.col);
 		}
 	};
+	using AsciiMapPosition = BasicAsciiMapPosition<long>;
+
+	template <typename T, typename Coordinate = long>
+	struct AsciiMapElement
+	{
+		using Position = BasicAsciiMapPosition<Coordinate>;
+
+		Position position;
+		T data;
+
+		explicit AsciiMapElement(const Position& position, T data)
+			: position(position), data(data) {}
+	};
 
-	template <typename T>
+	template <typename T, typename Coordinate = long>
 	class AsciiMapProcessor {
 	public:
+		using Position = BasicAsciiMapPosition<Coordinate>;
+
 		// TODO: Extract from class 
 		enum StopageReason
 		{
@@ -62,13 +88,15 @@ namespace utils
 			Newline,
 			EndOfFile,
 			ElementFound,
-			ParsingError
+			ParsingError,
+			// The dimensions of the map exceed the range of values representable by the chosen coordinate type
+			CoordinateOverflow
 		};
 
 		struct AsciiMapProcessingResult
 		{
 			StopageReason streamProcessingStopageReason;
-			AsciiMapPosition position;
+			Position position;
 			std::optional<T> data;
 
 			AsciiMapProcessingResult()
@@ -82,13 +110,19 @@ namespace utils
 		[[nodiscard]] bool findNextElement(std::istream& inputStream, const CharacterToEnumMapping* optionalCharacterToEnumMapping, AsciiMapProcessingResult& containerForFoundEntry, bool doNotReportNewlines)
 		{
 			auto determinedStopageReason = StopageReason::Unknown;
-			long columnPositionOfFoundElement = 0;
-			long rowPositionOfFoundElement = 0;
+			std::int64_t columnPositionOfFoundElement = 0;
+			std::int64_t rowPositionOfFoundElement = 0;
 			std::optional<T> foundElement;
 
 			// Reading the EOF character will not cause a failure of the stream read operation.
 			for (int lastProcessedCharacter = peekNextCharacterInStream(inputStream); inputStream && determinedStopageReason == StopageReason::Unknown; lastProcessedCharacter = peekNextCharacterInStream(inputStream))
 			{
+				if (doesPositionExceedCoordinateRange(lastProcessedRow, lastProcessedColumn))
+				{
+					determinedStopageReason = StopageReason::CoordinateOverflow;
+					break;
+				}
+
 				inputStream.get();
 				switch (lastProcessedCharacter)
 				{
@@ -126,6 +160,9 @@ namespace utils
 					case EOF:
 					{
 						determinedStopageReason = StopageReason::EndOfFile;
+						// Maps consisting of a single row do not contain a newline character from which the number of columns could be determined
+						if (!numColsOfAsciiField)
+							numColsOfAsciiField = lastProcessedColumn;
 						numRowsOfAsciiField = lastProcessedRow + 1;
 						break;
 					}
@@ -164,10 +201,16 @@ namespace utils
 				}
 			}
 
-			containerForFoundEntry.position.col = columnPositionOfFoundElement;
-			containerForFoundEntry.position.row = rowPositionOfFoundElement;
+			containerForFoundEntry.position.col = static_cast<Coordinate>(columnPositionOfFoundElement);
+			containerForFoundEntry.position.row = static_cast<Coordinate>(rowPositionOfFoundElement);
 			containerForFoundEntry.data = foundElement;
 
+			if (determinedStopageReason == StopageReason::CoordinateOverflow)
+			{
+				containerForFoundEntry.streamProcessingStopageReason = StopageReason::CoordinateOverflow;
+				return false;
+			}
+
 			if (!inputStream)
 			{
 				containerForFoundEntry.streamProcessingStopageReason = inputStream.eof() ? StopageReason::EndOfFile : StopageReason::ParsingError;
@@ -177,24 +220,131 @@ namespace utils
 			return containerForFoundEntry.streamProcessingStopageReason != StopageReason::ParsingError;
 		}
 
+		/// Hands every remaining row of the map to the given callable as rowProcessor(std::string_view row, Coordinate rowIndex), the view is only valid during the call.
+		/// Processing stops with a parsing error if the callable returns false.
+		/// @return EndOfFile if all rows were processed, otherwise the reason why the processing was stopped
+		template <typename RowProcessor>
+		[[nodiscard]] StopageReason processRows(std::istream& inputStream, RowProcessor&& rowProcessor)
+		{
+			for (;;)
+			{
+				std::string_view row;
+				Coordinate rowIndex = 0;
+				const StopageReason rowStopageReason = readNextRow(inputStream, row, rowIndex);
+				if (rowStopageReason != StopageReason::Newline && rowStopageReason != StopageReason::EndOfFile)
+					return rowStopageReason;
+
+				if (!rowProcessor(row, rowIndex))
+					return StopageReason::ParsingError;
+
+				if (rowStopageReason == StopageReason::EndOfFile)
+					return rowStopageReason;
+			}
+		}
+
+		/// Appends all relevant elements of the next row of the map to the given container while characters without a mapping (or dots if the processor operates on characters) are skipped.
+		/// @return Newline if further rows follow, EndOfFile if the processed row was the last one of the map, otherwise the reason why the processing was stopped
+		[[nodiscard]] StopageReason appendElementsOfNextRow(std::istream& inputStream, const CharacterToEnumMapping* optionalCharacterToEnumMapping, std::vector<AsciiMapElement<T, Coordinate>>& containerForFoundElements)
+		{
+			std::string_view row;
+			Coordinate rowIndex = 0;
+			const StopageReason rowStopageReason = readNextRow(inputStream, row, rowIndex);
+			if (rowStopageReason != StopageReason::Newline && rowStopageReason != StopageReason::EndOfFile)
+				return rowStopageReason;
+
+			if constexpr (!std::is_same_v<T, char>)
+			{
+				if (!optionalCharacterToEnumMapping)
+					return StopageReason::ParsingError;
+				updateCharacterClassificationLookup(*optionalCharacterToEnumMapping);
+			}
+
+			for (std::size_t col = 0; col < row.size(); ++col)
+			{
+				const char character = row[col];
+				if constexpr (!std::is_same_v<T, char>)
+				{
+					const std::optional<T>& classifiedCharacter = characterClassificationLookup[static_cast<unsigned char>(character)];
+					if (classifiedCharacter.has_value())
+						containerForFoundElements.emplace_back(Position(rowIndex, static_cast<Coordinate>(col)), *classifiedCharacter);
+				}
+				else if (character != '.')
+				{
+					containerForFoundElements.emplace_back(Position(rowIndex, static_cast<Coordinate>(col)), character);
+				}
+			}
+			return rowStopageReason;
+		}
+
 		[[maybe_unused]] static std::istream::int_type peekNextCharacterInStream(std::istream& inputStream)
 		{
 			return inputStream.peek();
 		}
 
-		[[nodiscard]] AsciiMapPosition determineMapBounderies() const
+		[[nodiscard]] Position determineMapBounderies() const
 		{
-			return AsciiMapPosition(numRowsOfAsciiField, numColsOfAsciiField);
+			return Position(static_cast<Coordinate>(numRowsOfAsciiField), static_cast<Coordinate>(numColsOfAsciiField));
 		}
 
 	protected:
-		long lastProcessedColumn;
-		long lastProcessedRow;
+		std::int64_t lastProcessedColumn;
+		std::int64_t lastProcessedRow;
+
+		std::int64_t numColsOfAsciiField;
+		std::int64_t numRowsOfAsciiField;
 
-		long numColsOfAsciiField;
-		long numRowsOfAsciiField;
+		std::string rowBuffer;
+		std::array<std::optional<T>, 256> characterClassificationLookup;
 
-		[[nodiscard]] StopageReason setBoundaryComponentOfMapOnlyIfNotSetOrEqualOtherwiseStopProcessing(long& boundaryComponentToSet, long newSizeOfBoundaryComponent)
+		/// Reads the next row of the map into the internal row buffer, every row (including an empty one following a trailing newline) is reported to be consistent with the dimensions determined by findNextElement.
+		[[nodiscard]] StopageReason readNextRow(std::istream& inputStream, std::string_view& row, Coordinate& rowIndex)
+		{
+			std::getline(inputStream, rowBuffer);
+			const bool reachedEndOfFile = inputStream.eof();
+			if (inputStream.fail() && !reachedEndOfFile)
+				return StopageReason::ParsingError;
+
+			row = rowBuffer;
+			#if defined(_WIN32) || defined(_WIN64)
+				if (!row.empty() && row.back() == '\r')
+					row.remove_suffix(1);
+			#endif
+			if (row.find('\r') != std::string_view::npos)
+				return StopageReason::ParsingError;
+
+			if (doesPositionExceedCoordinateRange(lastProcessedRow, static_cast<std::int64_t>(row.size())))
+				return StopageReason::CoordinateOverflow;
+
+			if (!numColsOfAsciiField)
+				numColsOfAsciiField = static_cast<std::int64_t>(row.size());
+
+			rowIndex = static_cast<Coordinate>(lastProcessedRow);
+			lastProcessedColumn = 0;
+			if (reachedEndOfFile)
+			{
+				numRowsOfAsciiField = lastProcessedRow + 1;
+				return StopageReason::EndOfFile;
+			}
+			++lastProcessedRow;
+			return StopageReason::Newline;
+		}
+
+		/// The lookup is rebuilt for every row since the mapping could have been modified (or replaced by another one at the same address) since the previous row was processed.
+		void updateCharacterClassificationLookup(const CharacterToEnumMapping& characterToEnumMapping)
+		{
+			characterClassificationLookup.fill(std::nullopt);
+			for (const auto& [character, mappedToValue] : characterToEnumMapping)
+				characterClassificationLookup[static_cast<unsigned char>(character)] = mappedToValue;
+		}
+
+		// Both the position of the next character as well as the dimensions of the map (i.e. the number of rows and columns) need to be representable by the coordinate type
+		[[nodiscard]] static constexpr bool doesPositionExceedCoordinateRange(std::int64_t row, std::int64_t col) noexcept
+		{
+			constexpr auto maxCoordinateValue = static_cast<std::int64_t>(std::numeric_limits<Coordinate>::max());
+			return row >= maxCoordinateValue || col >= maxCoordinateValue;
+		}
+
+		[[nodiscard]] StopageReason setBoundaryComponentOfMapOnlyIfNotSetOrEqualOtherwiseStopProcessing(std::int64_t& boundaryComponentToSet, std::int64_t newSizeOfBoundaryComponent)
 		{
 			if (boundaryComponentToSet == newSizeOfBoundaryComponent)
 				return StopageReason::Unknown;
@@ -207,6 +357,32 @@ namespace utils
 			return StopageReason::ParsingError;
 		}
 	};
+
+	/// Invokes the given processor with the narrowest coordinate type (std::int16_t, std::int32_t or std::int64_t) able to represent the positions of the ascii map contained in the stream.
+	/// The processor is called as processor(inputStream, Coordinate{}, exceededCoordinateRange) and is expected to set the last parameter when the map did not fit the coordinate type,
+	/// in which case the stream is rewound to its initial position and the next wider coordinate type is tried. Streams that do not support seeking are processed with the widest type.
+	template <typename Processor>
+	[[nodiscard]] auto processAsciiMapUsingNarrowestCoordinateType(std::istream& inputStream, Processor&& processor)
+	{
+		bool exceededCoordinateRange = false;
+		const std::istream::pos_type initialStreamPosition = inputStream.tellg();
+		if (initialStreamPosition != std::istream::pos_type(-1))
+		{
+			if (auto result = processor(inputStream, std::int16_t{}, exceededCoordinateRange); !exceededCoordinateRange)
+				return result;
+
+			inputStream.clear();
+			inputStream.seekg(initialStreamPosition);
+			exceededCoordinateRange = false;
+			if (auto result = processor(inputStream, std::int32_t{}, exceededCoordinateRange); !exceededCoordinateRange)
+				return result;
+
+			inputStream.clear();
+			inputStream.seekg(initialStreamPosition);
+			exceededCoordinateRange = false;
+		}
+		return processor(inputStream, std::int64_t{}, exceededCoordinateRange);
+	}
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,354 @@
+#ifndef UTILS_ASCII_MAP_STORAGE_HPP
+#define UTILS_ASCII_MAP_STORAGE_HPP
+
+#include "asciiMapProcessor.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <variant>
+#include <vector>
+
+namespace utils
+{
+	enum class AsciiMapStorageKind : char
+	{
+		Dense,
+		RunLengthEncoded,
+		SparseCoordinateList
+	};
+
+	/// Every element of the map is stored in a row-major grid with an additional occupancy bitmap, queries are answered in constant time.
+	template <typename T, typename Coordinate = long>
+	class DenseAsciiMapStorage
+	{
+	public:
+		using Position = BasicAsciiMapPosition<Coordinate>;
+
+		explicit DenseAsciiMapStorage(const Position& mapDimensions, const std::vector<AsciiMapElement<T, Coordinate>>& elementsInRowMajorOrder)
+			: numColsOfAsciiField(static_cast<std::size_t>(mapDimensions.col)), numElements(elementsInRowMajorOrder.size()),
+				cells(determineNumberOfCells(mapDimensions)), occupiedCells(determineNumberOfCells(mapDimensions), false)
+		{
+			for (const AsciiMapElement<T, Coordinate>& element : elementsInRowMajorOrder)
+			{
+				const std::size_t cellIndex = determineCellIndex(element.position);
+				cells[cellIndex] = element.data;
+				occupiedCells[cellIndex] = true;
+			}
+		}
+
+		[[nodiscard]] std::optional<T> getElementAt(const Position& position) const
+		{
+			const std::size_t cellIndex = determineCellIndex(position);
+			return occupiedCells[cellIndex] ? std::make_optional(cells[cellIndex]) : std::nullopt;
+		}
+
+		[[nodiscard]] bool containsElementAt(const Position& position) const
+		{
+			return occupiedCells[determineCellIndex(position)];
+		}
+
+		template <typename Callable>
+		void forEachElement(Callable&& callable) const
+		{
+			for (std::size_t cellIndex = 0; cellIndex < cells.size(); ++cellIndex)
+			{
+				if (occupiedCells[cellIndex])
+					callable(Position(static_cast<Coordinate>(cellIndex / numColsOfAsciiField), static_cast<Coordinate>(cellIndex % numColsOfAsciiField)), cells[cellIndex]);
+			}
+		}
+
+		[[nodiscard]] std::size_t getNumElements() const noexcept
+		{
+			return numElements;
+		}
+
+		[[nodiscard]] static std::size_t estimateMemoryFootprintInBytes(const Position& mapDimensions)
+		{
+			const std::size_t numCells = determineNumberOfCells(mapDimensions);
+			return numCells * sizeof(T) + (numCells + 7) / 8;
+		}
+
+	protected:
+		std::size_t numColsOfAsciiField;
+		std::size_t numElements;
+		std::vector<T> cells;
+		std::vector<bool> occupiedCells;
+
+		[[nodiscard]] std::size_t determineCellIndex(const Position& position) const noexcept
+		{
+			return static_cast<std::size_t>(position.row) * numColsOfAsciiField + static_cast<std::size_t>(position.col);
+		}
+
+		[[nodiscard]] static std::size_t determineNumberOfCells(const Position& mapDimensions) noexcept
+		{
+			return static_cast<std::size_t>(mapDimensions.row) * static_cast<std::size_t>(mapDimensions.col);
+		}
+	};
+
+	/// Horizontally adjacent elements sharing the same value are merged into runs, the runs of a row are sorted by their starting column and searched via binary search.
+	template <typename T, typename Coordinate = long>
+	class RunLengthEncodedAsciiMapStorage
+	{
+	public:
+		using Position = BasicAsciiMapPosition<Coordinate>;
+
+		struct Run
+		{
+			Coordinate startCol;
+			Coordinate length;
+			T data;
+		};
+
+		explicit RunLengthEncodedAsciiMapStorage(const Position& mapDimensions, const std::vector<AsciiMapElement<T, Coordinate>>& elementsInRowMajorOrder)
+			: numElements(elementsInRowMajorOrder.size()), firstRunIndexPerRow(static_cast<std::size_t>(mapDimensions.row) + 1, 0)
+		{
+			Coordinate rowOfLastRun = -1;
+			runs.reserve(determineNumberOfRuns(elementsInRowMajorOrder));
+			for (const AsciiMapElement<T, Coordinate>& element : elementsInRowMajorOrder)
+			{
+				if (canElementExtendRun(runs.empty() ? nullptr : &runs.back(), rowOfLastRun, element))
+				{
+					++runs.back().length;
+					continue;
+				}
+				runs.push_back(Run{ element.position.col, 1, element.data });
+				++firstRunIndexPerRow[static_cast<std::size_t>(element.position.row) + 1];
+				rowOfLastRun = element.position.row;
+			}
+
+			for (std::size_t row = 1; row < firstRunIndexPerRow.size(); ++row)
+				firstRunIndexPerRow[row] += firstRunIndexPerRow[row - 1];
+		}
+
+		[[nodiscard]] std::optional<T> getElementAt(const Position& position) const
+		{
+			const Run* matchingRun = findRunCoveringPosition(position);
+			return matchingRun ? std::make_optional(matchingRun->data) : std::nullopt;
+		}
+
+		[[nodiscard]] bool containsElementAt(const Position& position) const
+		{
+			return findRunCoveringPosition(position) != nullptr;
+		}
+
+		template <typename Callable>
+		void forEachElement(Callable&& callable) const
+		{
+			for (std::size_t row = 0; row + 1 < firstRunIndexPerRow.size(); ++row)
+			{
+				for (std::size_t runIndex = firstRunIndexPerRow[row]; runIndex < firstRunIndexPerRow[row + 1]; ++runIndex)
+				{
+					const Run& run = runs[runIndex];
+					for (Coordinate col = run.startCol; col < run.startCol + run.length; ++col)
+						callable(Position(static_cast<Coordinate>(row), col), run.data);
+				}
+			}
+		}
+
+		[[nodiscard]] std::size_t getNumElements() const noexcept
+		{
+			return numElements;
+		}
+
+		[[nodiscard]] static std::size_t estimateMemoryFootprintInBytes(const Position& mapDimensions, const std::vector<AsciiMapElement<T, Coordinate>>& elementsInRowMajorOrder)
+		{
+			return determineNumberOfRuns(elementsInRowMajorOrder) * sizeof(Run) + (static_cast<std::size_t>(mapDimensions.row) + 1) * sizeof(std::size_t);
+		}
+
+	protected:
+		std::size_t numElements;
+		std::vector<Run> runs;
+		std::vector<std::size_t> firstRunIndexPerRow;
+
+		[[nodiscard]] static bool canElementExtendRun(const Run* lastRun, Coordinate rowOfLastRun, const AsciiMapElement<T, Coordinate>& element)
+		{
+			return lastRun && rowOfLastRun == element.position.row && lastRun->startCol + lastRun->length == element.position.col && lastRun->data == element.data;
+		}
+
+		[[nodiscard]] static std::size_t determineNumberOfRuns(const std::vector<AsciiMapElement<T, Coordinate>>& elementsInRowMajorOrder)
+		{
+			std::size_t numRuns = 0;
+			for (std::size_t i = 0; i < elementsInRowMajorOrder.size(); ++i)
+			{
+				const bool extendsPreviousRun = i > 0
+					&& elementsInRowMajorOrder[i - 1].position.row == elementsInRowMajorOrder[i].position.row
+					&& elementsInRowMajorOrder[i - 1].position.col + 1 == elementsInRowMajorOrder[i].position.col
+					&& elementsInRowMajorOrder[i - 1].data == elementsInRowMajorOrder[i].data;
+				numRuns += !extendsPreviousRun;
+			}
+			return numRuns;
+		}
+
+		[[nodiscard]] const Run* findRunCoveringPosition(const Position& position) const
+		{
+			const auto firstRunOfRow = runs.cbegin() + static_cast<std::ptrdiff_t>(firstRunIndexPerRow[static_cast<std::size_t>(position.row)]);
+			const auto lastRunOfRow = runs.cbegin() + static_cast<std::ptrdiff_t>(firstRunIndexPerRow[static_cast<std::size_t>(position.row) + 1]);
+
+			// Find the first run starting after the given column, the run covering the column (if any) is its predecessor
+			const auto firstRunStartingAfterColumn = std::upper_bound(firstRunOfRow, lastRunOfRow, position.col, [](Coordinate col, const Run& run) { return col < run.startCol; });
+			if (firstRunStartingAfterColumn == firstRunOfRow)
+				return nullptr;
+
+			const Run& candidateRun = *std::prev(firstRunStartingAfterColumn);
+			return position.col < candidateRun.startCol + candidateRun.length ? &candidateRun : nullptr;
+		}
+	};
+
+	/// Only the columns and values of the elements are stored, grouped per row (similar to the compressed sparse row format) and searched via binary search.
+	template <typename T, typename Coordinate = long>
+	class SparseAsciiMapStorage
+	{
+	public:
+		using Position = BasicAsciiMapPosition<Coordinate>;
+
+		explicit SparseAsciiMapStorage(const Position& mapDimensions, const std::vector<AsciiMapElement<T, Coordinate>>& elementsInRowMajorOrder)
+			: firstElementIndexPerRow(static_cast<std::size_t>(mapDimensions.row) + 1, 0)
+		{
+			cols.reserve(elementsInRowMajorOrder.size());
+			values.reserve(elementsInRowMajorOrder.size());
+			for (const AsciiMapElement<T, Coordinate>& element : elementsInRowMajorOrder)
+			{
+				cols.emplace_back(element.position.col);
+				values.emplace_back(element.data);
+				++firstElementIndexPerRow[static_cast<std::size_t>(element.position.row) + 1];
+			}
+
+			for (std::size_t row = 1; row < firstElementIndexPerRow.size(); ++row)
+				firstElementIndexPerRow[row] += firstElementIndexPerRow[row - 1];
+		}
+
+		[[nodiscard]] std::optional<T> getElementAt(const Position& position) const
+		{
+			const std::optional<std::size_t> elementIndex = findElementIndex(position);
+			return elementIndex.has_value() ? std::make_optional(values[*elementIndex]) : std::nullopt;
+		}
+
+		[[nodiscard]] bool containsElementAt(const Position& position) const
+		{
+			return findElementIndex(position).has_value();
+		}
+
+		template <typename Callable>
+		void forEachElement(Callable&& callable) const
+		{
+			for (std::size_t row = 0; row + 1 < firstElementIndexPerRow.size(); ++row)
+			{
+				for (std::size_t elementIndex = firstElementIndexPerRow[row]; elementIndex < firstElementIndexPerRow[row + 1]; ++elementIndex)
+					callable(Position(static_cast<Coordinate>(row), cols[elementIndex]), values[elementIndex]);
+			}
+		}
+
+		[[nodiscard]] std::size_t getNumElements() const noexcept
+		{
+			return values.size();
+		}
+
+		[[nodiscard]] static std::size_t estimateMemoryFootprintInBytes(const Position& mapDimensions, const std::vector<AsciiMapElement<T, Coordinate>>& elementsInRowMajorOrder)
+		{
+			return elementsInRowMajorOrder.size() * (sizeof(Coordinate) + sizeof(T)) + (static_cast<std::size_t>(mapDimensions.row) + 1) * sizeof(std::size_t);
+		}
+
+	protected:
+		std::vector<Coordinate> cols;
+		std::vector<T> values;
+		std::vector<std::size_t> firstElementIndexPerRow;
+
+		[[nodiscard]] std::optional<std::size_t> findElementIndex(const Position& position) const
+		{
+			const auto firstColOfRow = cols.cbegin() + static_cast<std::ptrdiff_t>(firstElementIndexPerRow[static_cast<std::size_t>(position.row)]);
+			const auto lastColOfRow = cols.cbegin() + static_cast<std::ptrdiff_t>(firstElementIndexPerRow[static_cast<std::size_t>(position.row) + 1]);
+
+			const auto matchingCol = std::lower_bound(firstColOfRow, lastColOfRow, position.col);
+			return matchingCol != lastColOfRow && *matchingCol == position.col ? std::make_optional(static_cast<std::size_t>(std::distance(cols.cbegin(), matchingCol))) : std::nullopt;
+		}
+	};
+
+	/// Storage for the relevant elements of an ascii map whose internal representation (dense grid, row-wise run-length encoding or sorted per-row coordinate lists)
+	/// is chosen based on the estimated memory footprint of each representation for the given elements. Positions outside of the map dimensions are reported as empty
+	/// and elements outside of the latter are not recorded.
+	template <typename T, typename Coordinate = long>
+	class AsciiMapStorage
+	{
+	public:
+		using Position = BasicAsciiMapPosition<Coordinate>;
+
+		[[nodiscard]] static AsciiMapStorage fromElements(const Position& mapDimensions, std::vector<AsciiMapElement<T, Coordinate>>&& elements)
+		{
+			elements.erase(
+				std::remove_if(elements.begin(), elements.end(), [&mapDimensions](const AsciiMapElement<T, Coordinate>& element) { return !isPositionWithinMapBounds(element.position, mapDimensions); }),
+				elements.end());
+
+			const auto isInRowMajorOrder = [](const AsciiMapElement<T, Coordinate>& lElement, const AsciiMapElement<T, Coordinate>& rElement)
+			{
+				return lElement.position.row < rElement.position.row || (lElement.position.row == rElement.position.row && lElement.position.col < rElement.position.col);
+			};
+			// Elements reported by the AsciiMapProcessor are already in row-major order, thus the sort should only be required for elements recorded by other means.
+			if (!std::is_sorted(elements.cbegin(), elements.cend(), isInRowMajorOrder))
+				std::sort(elements.begin(), elements.end(), isInRowMajorOrder);
+
+			const std::size_t denseFootprint = DenseAsciiMapStorage<T, Coordinate>::estimateMemoryFootprintInBytes(mapDimensions);
+			const std::size_t runLengthEncodedFootprint = RunLengthEncodedAsciiMapStorage<T, Coordinate>::estimateMemoryFootprintInBytes(mapDimensions, elements);
+			const std::size_t sparseFootprint = SparseAsciiMapStorage<T, Coordinate>::estimateMemoryFootprintInBytes(mapDimensions, elements);
+
+			// The dense representation is preferred on ties since it offers constant time queries.
+			if (denseFootprint <= runLengthEncodedFootprint && denseFootprint <= sparseFootprint)
+				return AsciiMapStorage(mapDimensions, DenseAsciiMapStorage<T, Coordinate>(mapDimensions, elements));
+			if (runLengthEncodedFootprint < sparseFootprint)
+				return AsciiMapStorage(mapDimensions, RunLengthEncodedAsciiMapStorage<T, Coordinate>(mapDimensions, elements));
+			return AsciiMapStorage(mapDimensions, SparseAsciiMapStorage<T, Coordinate>(mapDimensions, elements));
+		}
+
+		[[nodiscard]] std::optional<T> getElementAt(const Position& position) const
+		{
+			if (!isPositionWithinMapBounds(position, mapDimensions))
+				return std::nullopt;
+
+			return std::visit([&position](const auto& storage) { return storage.getElementAt(position); }, storage);
+		}
+
+		[[nodiscard]] bool containsElementAt(const Position& position) const
+		{
+			return isPositionWithinMapBounds(position, mapDimensions) && std::visit([&position](const auto& storage) { return storage.containsElementAt(position); }, storage);
+		}
+
+		template <typename Callable>
+		void forEachElement(Callable&& callable) const
+		{
+			std::visit([&callable](const auto& storage) { storage.forEachElement(callable); }, storage);
+		}
+
+		[[nodiscard]] std::size_t getNumElements() const
+		{
+			return std::visit([](const auto& storage) { return storage.getNumElements(); }, storage);
+		}
+
+		[[nodiscard]] AsciiMapStorageKind getStorageKind() const noexcept
+		{
+			return static_cast<AsciiMapStorageKind>(storage.index());
+		}
+
+		[[nodiscard]] Position determineMapBounderies() const noexcept
+		{
+			return mapDimensions;
+		}
+
+	protected:
+		// The order of the alternatives must match the one of the AsciiMapStorageKind enum
+		using StorageVariant = std::variant<DenseAsciiMapStorage<T, Coordinate>, RunLengthEncodedAsciiMapStorage<T, Coordinate>, SparseAsciiMapStorage<T, Coordinate>>;
+
+		Position mapDimensions;
+		StorageVariant storage;
+
+		template <typename Storage>
+		explicit AsciiMapStorage(const Position& mapDimensions, Storage&& storage)
+			: mapDimensions(mapDimensions), storage(std::forward<Storage>(storage)) {}
+
+		[[nodiscard]] static bool isPositionWithinMapBounds(const Position& position, const Position& mapDimensions) noexcept
+		{
+			return position.row >= 0 && position.row < mapDimensions.row && position.col >= 0 && position.col < mapDimensions.col;
+		}
+	};
+}
+
+#endif
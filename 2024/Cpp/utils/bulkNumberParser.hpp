@@ -0,0 +1,128 @@
+#ifndef UTILS_BULK_NUMBER_PARSER_HPP
+#define UTILS_BULK_NUMBER_PARSER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace utils
+{
+	/// Parses decimal numbers from an in-memory buffer, eight digits at a time are classified and converted using SIMD within a register (SWAR) operations on a 64-bit integer.
+	class BulkNumberParser
+	{
+	public:
+		/// Parses the decimal number starting at the given offset with a leading '-' only being accepted for signed types, the offset is advanced past the last parsed digit.
+		/// @return Whether at least one digit was parsed and the number is representable by the given type
+		template <typename T>
+		[[nodiscard]] static bool parseNumber(std::string_view buffer, std::size_t& currentByteOffset, T& parsedNumber) noexcept
+		{
+			static_assert(std::is_integral_v<T>, "Only integral numbers can be parsed");
+
+			bool isNegative = false;
+			if constexpr (std::is_signed_v<T>)
+			{
+				isNegative = currentByteOffset < buffer.size() && buffer[currentByteOffset] == '-';
+				currentByteOffset += isNegative;
+			}
+
+			// The magnitude of the smallest value of a signed type is larger by one than the one of its largest value
+			const auto maxMagnitude = static_cast<std::uint64_t>(std::numeric_limits<T>::max()) + isNegative;
+			std::uint64_t magnitude = 0;
+			if (!parseMagnitude(buffer, currentByteOffset, maxMagnitude, magnitude))
+				return false;
+
+			if constexpr (std::is_signed_v<T>)
+				parsedNumber = isNegative ? static_cast<T>(-static_cast<T>(magnitude - 1) - 1) : static_cast<T>(magnitude);
+			else
+				parsedNumber = static_cast<T>(magnitude);
+			return true;
+		}
+
+	protected:
+#if defined(_MSC_VER) || (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+		static constexpr bool IS_LITTLE_ENDIAN_PLATFORM = true;
+#else
+		static constexpr bool IS_LITTLE_ENDIAN_PLATFORM = false;
+#endif
+		static constexpr std::size_t NUM_DIGITS_PER_BLOCK = sizeof(std::uint64_t);
+		static constexpr std::uint64_t REPEATED_ZERO_CHARACTER = 0x3030303030303030;
+		static constexpr std::uint64_t REPEATED_HIGH_BIT = 0x8080808080808080;
+		static constexpr std::uint64_t REPEATED_LOW_SEVEN_BITS = 0x7F7F7F7F7F7F7F7F;
+		// Adding 0x76 to a byte with a value in [0, 127] sets its high bit if and only if the value is larger than nine without carrying into the next byte
+		static constexpr std::uint64_t REPEATED_NON_DIGIT_OFFSET = 0x7676767676767676;
+
+		[[nodiscard]] static bool parseMagnitude(std::string_view buffer, std::size_t& currentByteOffset, std::uint64_t maxMagnitude, std::uint64_t& magnitude) noexcept
+		{
+			const std::size_t offsetOfFirstDigit = currentByteOffset;
+			if constexpr (IS_LITTLE_ENDIAN_PLATFORM)
+			{
+				while (currentByteOffset + NUM_DIGITS_PER_BLOCK <= buffer.size())
+				{
+					std::uint64_t block;
+					std::memcpy(&block, buffer.data() + currentByteOffset, NUM_DIGITS_PER_BLOCK);
+
+					// Subtracting the character '0' is done via an exclusive or which maps the digits to their value without borrowing from the neighbouring bytes
+					const std::uint64_t digitValues = block ^ REPEATED_ZERO_CHARACTER;
+					const std::uint64_t nonDigitBytes = (((digitValues & REPEATED_LOW_SEVEN_BITS) + REPEATED_NON_DIGIT_OFFSET) | digitValues) & REPEATED_HIGH_BIT;
+					const std::size_t numDigits = nonDigitBytes ? countTrailingZeroBits(nonDigitBytes) / 8 : NUM_DIGITS_PER_BLOCK;
+					if (numDigits && !appendDigits(convertDigitsOfBlock(digitValues, numDigits), numDigits, maxMagnitude, magnitude))
+						return false;
+
+					currentByteOffset += numDigits;
+					if (numDigits != NUM_DIGITS_PER_BLOCK)
+						return currentByteOffset != offsetOfFirstDigit;
+				}
+			}
+
+			for (; currentByteOffset < buffer.size() && static_cast<unsigned char>(buffer[currentByteOffset] - '0') < 10; ++currentByteOffset)
+			{
+				if (!appendDigits(static_cast<std::uint64_t>(buffer[currentByteOffset] - '0'), 1, maxMagnitude, magnitude))
+					return false;
+			}
+			return currentByteOffset != offsetOfFirstDigit;
+		}
+
+		[[nodiscard]] static bool appendDigits(std::uint64_t valueOfDigits, std::size_t numDigits, std::uint64_t maxMagnitude, std::uint64_t& magnitude) noexcept
+		{
+			std::uint64_t powerOfTen = 1;
+			for (std::size_t i = 0; i < numDigits; ++i)
+				powerOfTen *= 10;
+
+			if (valueOfDigits > maxMagnitude || magnitude > (maxMagnitude - valueOfDigits) / powerOfTen)
+				return false;
+			magnitude = magnitude * powerOfTen + valueOfDigits;
+			return true;
+		}
+
+		/// The leading digits of a block are moved into the most significant bytes with the vacated bytes acting as leading zeros, afterwards neighbouring pairs of digits, pairs of two digit
+		/// numbers and pairs of four digit numbers are combined by a single multiplication each.
+		[[nodiscard]] static std::uint64_t convertDigitsOfBlock(std::uint64_t digitValues, std::size_t numDigits) noexcept
+		{
+			std::uint64_t value = digitValues << (8 * (NUM_DIGITS_PER_BLOCK - numDigits));
+			value = (value * 10 + (value >> 8)) & 0x00FF00FF00FF00FF;
+			value = (value * 100 + (value >> 16)) & 0x0000FFFF0000FFFF;
+			value = (value * 10000 + (value >> 32)) & 0x00000000FFFFFFFF;
+			return value;
+		}
+
+		[[nodiscard]] static std::size_t countTrailingZeroBits(std::uint64_t value) noexcept
+		{
+#if defined(_MSC_VER)
+			unsigned long indexOfLowestSetBit;
+			_BitScanForward64(&indexOfLowestSetBit, value);
+			return indexOfLowestSetBit;
+#else
+			return static_cast<std::size_t>(__builtin_ctzll(value));
+#endif
+		}
+	};
+}
+
+#endif
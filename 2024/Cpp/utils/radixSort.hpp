@@ -0,0 +1,174 @@
+#ifndef UTILS_RADIX_SORT_HPP
+#define UTILS_RADIX_SORT_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace utils
+{
+	/// Least significant digit radix sort for integral types processing one byte per pass, the scratch buffer used for the scatter passes is owned by the instance and thus only reused by sort operations of the same instance.
+	template <typename T>
+	class RadixSorter
+	{
+	public:
+		static_assert(std::is_integral_v<T>, "Radix sort is only supported for integral types");
+
+		/// Sorts the given elements in ascending order, the elements are exchanged with the internal scratch buffer if an odd number of passes was required.
+		void sort(std::vector<T>& elements)
+		{
+			sortInParallel(elements, 1);
+		}
+
+		/// Sorts the given elements in ascending order using the given number of threads (zero will use the number of hardware threads).
+		void sortInParallel(std::vector<T>& elements, std::size_t numThreads)
+		{
+			if (elements.size() < MIN_NUM_ELEMENTS_FOR_RADIX_SORT)
+			{
+				std::sort(elements.begin(), elements.end());
+				return;
+			}
+
+			if (!numThreads)
+				numThreads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+			numThreads = std::max<std::size_t>(1, std::min(numThreads, elements.size() / MIN_NUM_ELEMENTS_PER_THREAD));
+
+			scratchBuffer.resize(elements.size());
+			perThreadDigitCounts.resize(numThreads);
+
+			// The digit histograms of all passes are determined upfront to be able to skip passes in which all elements share the same digit.
+			processSlicesInParallel(elements.size(), numThreads, [&](std::size_t threadIndex, std::size_t firstElementIndex, std::size_t lastElementIndex)
+			{
+				std::array<DigitCounts, NUM_PASSES>& digitCountsPerPass = perThreadDigitCounts[threadIndex];
+				for (DigitCounts& digitCounts : digitCountsPerPass)
+					digitCounts.fill(0);
+
+				for (std::size_t i = firstElementIndex; i < lastElementIndex; ++i)
+				{
+					const UnsignedKey key = determineKey(elements[i]);
+					for (std::size_t pass = 0; pass < NUM_PASSES; ++pass)
+						++digitCountsPerPass[pass][determineDigit(key, pass)];
+				}
+			});
+
+			std::vector<T>* source = &elements;
+			std::vector<T>* destination = &scratchBuffer;
+			bool isFirstExecutedPass = true;
+			for (std::size_t pass = 0; pass < NUM_PASSES; ++pass)
+			{
+				if (doAllElementsShareDigitInPass(elements.size(), pass))
+					continue;
+
+				// The per thread histograms of the passes following the first one are only known after the previous scatter pass rearranged the elements.
+				if (!isFirstExecutedPass)
+				{
+					processSlicesInParallel(elements.size(), numThreads, [&](std::size_t threadIndex, std::size_t firstElementIndex, std::size_t lastElementIndex)
+					{
+						DigitCounts& digitCounts = perThreadDigitCounts[threadIndex][pass];
+						digitCounts.fill(0);
+						for (std::size_t i = firstElementIndex; i < lastElementIndex; ++i)
+							++digitCounts[determineDigit(determineKey((*source)[i]), pass)];
+					});
+				}
+				determineScatterOffsets(numThreads, pass);
+
+				processSlicesInParallel(elements.size(), numThreads, [&](std::size_t threadIndex, std::size_t firstElementIndex, std::size_t lastElementIndex)
+				{
+					DigitCounts& scatterOffsets = perThreadDigitCounts[threadIndex][pass];
+					T* destinationElements = destination->data();
+					for (std::size_t i = firstElementIndex; i < lastElementIndex; ++i)
+					{
+						const T element = (*source)[i];
+						destinationElements[scatterOffsets[determineDigit(determineKey(element), pass)]++] = element;
+					}
+				});
+				std::swap(source, destination);
+				isFirstExecutedPass = false;
+			}
+
+			if (source != &elements)
+				elements.swap(scratchBuffer);
+		}
+
+	protected:
+		using UnsignedKey = std::make_unsigned_t<T>;
+		using DigitCounts = std::array<std::size_t, 256>;
+
+		static constexpr std::size_t NUM_PASSES = sizeof(T);
+		static constexpr std::size_t MIN_NUM_ELEMENTS_FOR_RADIX_SORT = 256;
+		static constexpr std::size_t MIN_NUM_ELEMENTS_PER_THREAD = 1 << 16;
+
+		std::vector<T> scratchBuffer;
+		std::vector<std::array<DigitCounts, NUM_PASSES>> perThreadDigitCounts;
+
+		/// Flipping the sign bit of signed types maps the negative values in front of the positive ones when comparing the unsigned keys.
+		[[nodiscard]] static constexpr UnsignedKey determineKey(T element) noexcept
+		{
+			if constexpr (std::is_signed_v<T>)
+				return static_cast<UnsignedKey>(element) ^ (UnsignedKey{ 1 } << (std::numeric_limits<UnsignedKey>::digits - 1));
+			else
+				return static_cast<UnsignedKey>(element);
+		}
+
+		[[nodiscard]] static constexpr std::size_t determineDigit(UnsignedKey key, std::size_t pass) noexcept
+		{
+			return static_cast<std::size_t>((key >> (pass * 8)) & 0xFF);
+		}
+
+		[[nodiscard]] bool doAllElementsShareDigitInPass(std::size_t numElements, std::size_t pass) const
+		{
+			for (std::size_t digit = 0; digit < 256; ++digit)
+			{
+				std::size_t numElementsWithDigit = 0;
+				for (const std::array<DigitCounts, NUM_PASSES>& digitCountsPerPass : perThreadDigitCounts)
+					numElementsWithDigit += digitCountsPerPass[pass][digit];
+
+				if (numElementsWithDigit)
+					return numElementsWithDigit == numElements;
+			}
+			return true;
+		}
+
+		/// Converts the per thread digit counts of the given pass into the index at which each thread writes its next element with the given digit, keeping the sort stable.
+		void determineScatterOffsets(std::size_t numThreads, std::size_t pass)
+		{
+			std::size_t nextFreeIndex = 0;
+			for (std::size_t digit = 0; digit < 256; ++digit)
+			{
+				for (std::size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+				{
+					std::size_t& digitCount = perThreadDigitCounts[threadIndex][pass][digit];
+					const std::size_t numElementsOfThreadWithDigit = digitCount;
+					digitCount = nextFreeIndex;
+					nextFreeIndex += numElementsOfThreadWithDigit;
+				}
+			}
+		}
+
+		template <typename SliceProcessor>
+		static void processSlicesInParallel(std::size_t numElements, std::size_t numThreads, SliceProcessor&& sliceProcessor)
+		{
+			const std::size_t numElementsPerThread = numElements / numThreads;
+			std::vector<std::thread> workerThreads;
+			workerThreads.reserve(numThreads - 1);
+			for (std::size_t threadIndex = 1; threadIndex < numThreads; ++threadIndex)
+			{
+				const std::size_t lastElementIndex = threadIndex + 1 == numThreads ? numElements : (threadIndex + 1) * numElementsPerThread;
+				workerThreads.emplace_back([&sliceProcessor, threadIndex, numElementsPerThread, lastElementIndex]()
+				{
+					sliceProcessor(threadIndex, threadIndex * numElementsPerThread, lastElementIndex);
+				});
+			}
+
+			sliceProcessor(0, 0, numThreads == 1 ? numElements : numElementsPerThread);
+			for (std::thread& workerThread : workerThreads)
+				workerThread.join();
+		}
+	};
+}
+
+#endif